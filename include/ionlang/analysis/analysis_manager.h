@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/construct/construct.h>
+
+namespace ionlang {
+    enum class AnalysisDependency {
+        /**
+         * The result only depends on the analyzed construct itself, and
+         * remains valid until that construct is modified.
+         */
+        Local,
+
+        /**
+         * The result depends on the surrounding tree (ex. the construct's
+         * ancestors), and remains valid until any construct within the
+         * same tree is modified, or the construct moves to another tree.
+         */
+        Tree
+    };
+
+    /**
+     * Caches analysis results per construct and analysis. An analysis is
+     * a type providing a Result typedef, a static dependency member and a
+     * static run(Construct *, AnalysisManager &) function. Results are
+     * stamped with the version they were computed at (see
+     * Construct::markModified()), and recomputed once stale. Queries may
+     * be made from several threads at once. Results must not own parts
+     * of the tree (ex. hold raw pointers instead), otherwise the cache
+     * would keep the analyzed constructs alive.
+     */
+    class AnalysisManager {
+    private:
+        /**
+         * Analyses are identified by the address of their tag, avoiding
+         * any RTTI lookup.
+         */
+        template<typename TAnalysis>
+        static inline const char analysisTag = 0;
+
+        struct Key {
+            const Construct *construct;
+
+            const void *analysisId;
+
+            [[nodiscard]] bool operator==(const Key &other) const noexcept {
+                return this->construct == other.construct
+                    && this->analysisId == other.analysisId;
+            }
+        };
+
+        struct KeyHash {
+            [[nodiscard]] size_t operator()(const Key &key) const noexcept {
+                size_t constructHash = std::hash<const void *>{}(key.construct);
+
+                return constructHash ^ (std::hash<const void *>{}(key.analysisId) * 31);
+            }
+        };
+
+        /**
+         * Identifies the state a result was computed at: the construct
+         * (or tree root) whose version is tracked, and that version.
+         */
+        struct Stamp {
+            const Construct *versioned;
+
+            uint64_t version;
+
+            [[nodiscard]] bool operator==(const Stamp &other) const noexcept {
+                return this->versioned == other.versioned
+                    && this->version == other.version;
+            }
+
+            [[nodiscard]] bool operator!=(const Stamp &other) const noexcept {
+                return !(*this == other);
+            }
+        };
+
+        struct Entry {
+            /**
+             * Used to detect the construct being freed, in which case its
+             * address may have been reused by another construct.
+             */
+            std::weak_ptr<Construct> owner;
+
+            Stamp stamp;
+
+            /**
+             * Computes the stamp of the owner as of now, used to find
+             * stale entries without knowing the analysis.
+             */
+            Stamp (*getCurrentStamp)(Construct *construct);
+
+            std::shared_ptr<const void> result;
+        };
+
+        /**
+         * The least amount of entries at which expired entries are
+         * swept, see pruneExpired().
+         */
+        static constexpr size_t minimumPruneThreshold = 256;
+
+        mutable std::mutex mutex;
+
+        std::unordered_map<Key, Entry, KeyHash> entries;
+
+        size_t hitCount;
+
+        size_t missCount;
+
+        /**
+         * The amount of entries at which expired entries are swept next.
+         * Doubles with the amount of live entries, so that sweeping stays
+         * amortized constant per query.
+         */
+        size_t pruneThreshold;
+
+        /**
+         * Drop the entries whose construct was freed. Must be invoked
+         * with the mutex held.
+         */
+        void pruneExpired();
+
+        template<typename TAnalysis>
+        [[nodiscard]] static Stamp getCurrentStamp(Construct *construct) noexcept {
+            if constexpr (TAnalysis::dependency == AnalysisDependency::Local) {
+                return Stamp{construct, construct->version};
+            }
+
+            Construct *root = construct->findTreeRoot();
+
+            return Stamp{root, root->getTreeVersion()};
+        }
+
+    public:
+        AnalysisManager();
+
+        /**
+         * Retrieve the result of the analysis on the given construct,
+         * computing it if there is no valid cached result. Analyses
+         * may query other analyses while running.
+         */
+        template<typename TAnalysis>
+        [[nodiscard]] std::shared_ptr<const typename TAnalysis::Result> get(Construct *construct) {
+            typedef typename TAnalysis::Result Result;
+
+            Key key = Key{construct, &AnalysisManager::analysisTag<TAnalysis>};
+            Stamp stamp = AnalysisManager::getCurrentStamp<TAnalysis>(construct);
+
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                auto entry = this->entries.find(key);
+
+                if (entry != this->entries.end()
+                    && entry->second.stamp == stamp
+                    && !entry->second.owner.expired()) {
+                    this->hitCount++;
+
+                    return std::static_pointer_cast<const Result>(entry->second.result);
+                }
+
+                this->missCount++;
+            }
+
+            // The lock is not held while running, as analyses may nest.
+            std::shared_ptr<const Result> result =
+                std::make_shared<const Result>(TAnalysis::run(construct, *this));
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            this->entries[key] = Entry{
+                construct->nativeCast(),
+                stamp,
+                &AnalysisManager::getCurrentStamp<TAnalysis>,
+                result
+            };
+
+            if (this->entries.size() >= this->pruneThreshold) {
+                this->pruneExpired();
+            }
+
+            return result;
+        }
+
+        /**
+         * Drop all cached results of the given construct.
+         */
+        void invalidate(const Construct *construct);
+
+        /**
+         * Drop the cached results whose construct was freed, or which
+         * are stale. Must not be invoked while constructs are being
+         * modified.
+         */
+        void prune();
+
+        void clear();
+
+        [[nodiscard]] size_t getSize() const;
+
+        [[nodiscard]] size_t getHitCount() const;
+
+        [[nodiscard]] size_t getMissCount() const;
+    };
+}
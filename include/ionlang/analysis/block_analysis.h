@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+#include <ionlang/analysis/analysis_manager.h>
+#include <ionlang/construct/block.h>
+
+namespace ionlang {
+    /**
+     * The function enclosing a block, or nullptr if there is none. See
+     * Block::findParentFunction(). Cached results must not keep the
+     * tree alive, thus the function is not owned.
+     */
+    struct ParentFunctionAnalysis {
+        typedef Function *Result;
+
+        static constexpr AnalysisDependency dependency = AnalysisDependency::Tree;
+
+        [[nodiscard]] static Result run(Construct *construct, AnalysisManager &analysisManager);
+    };
+
+    /**
+     * The terminal statements directly within a block, not owned. See
+     * Block::findTerminals().
+     */
+    struct TerminalsAnalysis {
+        typedef std::vector<Statement *> Result;
+
+        static constexpr AnalysisDependency dependency = AnalysisDependency::Local;
+
+        [[nodiscard]] static Result run(Construct *construct, AnalysisManager &analysisManager);
+    };
+}
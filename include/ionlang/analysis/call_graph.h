@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <ionlang/analysis/analysis_manager.h>
+#include <ionlang/construct/module.h>
+
+namespace ionlang {
+    /**
+     * The calls between the functions and externs of a module, as given
+     * by resolved callee references. Externs have no body, and thus never
+     * call anything. Calls to constructs outside of the module are not
+     * recorded.
+     */
+    class CallGraph {
+    private:
+        /**
+         * Functions and externs, in the iteration order of the module's
+         * symbol table (the order they were first added to it, see
+         * FlatSymbolTable::forEach()).
+         */
+        std::vector<Construct *> nodes;
+
+        std::unordered_map<const Construct *, size_t> indices;
+
+        std::vector<std::vector<size_t>> calleeIndices;
+
+        std::vector<std::vector<size_t>> callerIndices;
+
+        /**
+         * Strongly connected components, in bottom-up order. Every
+         * component only calls components which precede it (or itself).
+         */
+        std::vector<std::vector<Construct *>> components;
+
+        std::vector<size_t> componentIndices;
+
+        std::vector<bool> selfCalls;
+
+        [[nodiscard]] std::vector<Construct *> resolveIndices(const std::vector<size_t> &indices) const;
+
+        /**
+         * Find the strongly connected components using an iterative
+         * version of Tarjan's algorithm.
+         */
+        void computeComponents();
+
+    public:
+        [[nodiscard]] static CallGraph build(Module *module);
+
+        CallGraph();
+
+        [[nodiscard]] const std::vector<Construct *> &getNodes() const noexcept;
+
+        [[nodiscard]] bool contains(const Construct *construct) const;
+
+        /**
+         * The constructs called by the given function, each listed
+         * once regardless of the amount of call sites.
+         */
+        [[nodiscard]] std::vector<Construct *> getCallees(const Construct *construct) const;
+
+        [[nodiscard]] std::vector<Construct *> getCallers(const Construct *construct) const;
+
+        [[nodiscard]] const std::vector<std::vector<Construct *>> &getComponents() const noexcept;
+
+        [[nodiscard]] std::optional<size_t> findComponentIndex(const Construct *construct) const;
+
+        /**
+         * Whether the function may call itself, either directly or
+         * through other functions.
+         */
+        [[nodiscard]] bool isRecursive(const Construct *construct) const;
+
+        /**
+         * All nodes, with callees preceding their callers. Nodes within
+         * the same component are kept together, in no particular order.
+         */
+        [[nodiscard]] std::vector<Construct *> getBottomUpOrder() const;
+
+        /**
+         * All nodes, with callers preceding their callees. The reverse of
+         * getBottomUpOrder().
+         */
+        [[nodiscard]] std::vector<Construct *> getTopDownOrder() const;
+    };
+
+    struct CallGraphAnalysis {
+        typedef CallGraph Result;
+
+        static constexpr AnalysisDependency dependency = AnalysisDependency::Tree;
+
+        [[nodiscard]] static Result run(Construct *construct, AnalysisManager &analysisManager);
+    };
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <variant>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/construct/expression/binary_operation.h>
+#include <ionlang/construct/expression/unary_operation.h>
+#include <ionlang/construct/type/integer_type.h>
+#include <ionlang/construct/value.h>
+#include <ionlang/type_system/type_context.h>
+
+namespace ionlang {
+    struct IntegerConstant {
+        ionshared::Ptr<IntegerType> type;
+
+        /**
+         * The value's bits, sign-extended if the type is signed and
+         * zero-extended otherwise. Unsigned 64-bit values above the
+         * signed maximum are therefore stored as negative numbers.
+         */
+        int64_t value;
+    };
+
+    typedef std::variant<IntegerConstant, bool> Constant;
+
+    enum class EvaluationStatus {
+        Success,
+
+        /**
+         * The result did not fit the type and was wrapped around. The
+         * wrapped result is still provided.
+         */
+        Overflow,
+
+        DivisionByZero,
+
+        /**
+         * The operation is not defined for the operands (ex. mismatching
+         * types), or cannot be evaluated at compile time.
+         */
+        Unsupported
+    };
+
+    struct EvaluationResult {
+        EvaluationStatus status;
+
+        std::optional<Constant> value = std::nullopt;
+    };
+
+    /**
+     * Evaluates operations on integer and boolean constants, following
+     * the wraparound semantics of the operands' integer type.
+     */
+    class ConstantEvaluator {
+    public:
+        /**
+         * The amount of bits of the integer type, or std::nullopt if
+         * integers of such type cannot be evaluated (ex. 128-bit).
+         */
+        [[nodiscard]] static std::optional<uint32_t> findBitWidth(const IntegerType &type) noexcept;
+
+        /**
+         * Truncate the bits to the given width, then sign-extend or
+         * zero-extend them back to 64 bits.
+         */
+        [[nodiscard]] static int64_t normalize(uint64_t bits, uint32_t bitWidth, bool isSigned) noexcept;
+
+        /**
+         * Retrieve the constant held by a literal, if the construct is
+         * an integer or boolean literal of a supported type.
+         */
+        [[nodiscard]] static std::optional<Constant> findConstant(Construct *construct);
+
+        /**
+         * Create a literal holding the constant. Integer literals keep the
+         * constant's type, while boolean literals obtain theirs from the
+         * given type context (usually that of the module being folded).
+         */
+        [[nodiscard]] static ionshared::Ptr<Construct> makeLiteral(
+            const Constant &constant,
+            const ionshared::Ptr<TypeContext> &typeContext
+        );
+
+        [[nodiscard]] static bool isEqual(const Constant &first, const Constant &second) noexcept;
+
+        [[nodiscard]] static EvaluationResult evaluateBinary(
+            Operator operation,
+            const Constant &leftSide,
+            const Constant &rightSide
+        );
+
+        [[nodiscard]] static EvaluationResult evaluateUnary(Operator operation, const Constant &value);
+
+        /**
+         * Evaluate a unary or binary operation whose operands are literals.
+         * Returns std::nullopt if the expression is of another kind, or if
+         * any of its operands is not a literal.
+         */
+        [[nodiscard]] static std::optional<EvaluationResult> evaluate(Expression *expression);
+    };
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string_view>
+#include <unordered_map>
+#include <ionlang/analysis/call_graph.h>
+#include <ionlang/construct/extern.h>
+
+namespace ionlang {
+    /**
+     * Ordered from the weakest to the strongest effect, so that the
+     * effect of several constructs is the greatest among them.
+     */
+    enum class Effect {
+        /**
+         * Only depends on its arguments, and has no observable effect
+         * besides yielding its result.
+         */
+        Pure,
+
+        /**
+         * May observe state besides its arguments, but never modifies it.
+         */
+        ReadOnly,
+
+        SideEffecting
+    };
+
+    /**
+     * The effects of calling each function and extern of a module. Externs
+     * are side-effecting unless annotated with the pure or read-only
+     * attribute. Functions may only observe or modify state through
+     * calls, so their effect is the greatest among their callees. Calls
+     * to unresolved or foreign constructs are side-effecting. Mutually
+     * recursive functions share the same effect.
+     */
+    class EffectSummary {
+    private:
+        std::unordered_map<const Construct *, Effect> effects;
+
+        [[nodiscard]] static Effect findExternEffect(const Extern *externConstruct);
+
+    public:
+        static constexpr std::string_view pureAttributeName = "pure";
+
+        static constexpr std::string_view readOnlyAttributeName = "readonly";
+
+        [[nodiscard]] static EffectSummary build(const CallGraph &callGraph);
+
+        EffectSummary();
+
+        /**
+         * The effect of calling the construct. Constructs outside of the
+         * module are side-effecting.
+         */
+        [[nodiscard]] Effect getEffect(const Construct *construct) const;
+
+        [[nodiscard]] bool isPure(const Construct *construct) const;
+    };
+
+    struct EffectAnalysis {
+        typedef EffectSummary Result;
+
+        static constexpr AnalysisDependency dependency = AnalysisDependency::Tree;
+
+        [[nodiscard]] static Result run(Construct *construct, AnalysisManager &analysisManager);
+    };
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <ionlang/analysis/analysis_manager.h>
+#include <ionlang/construct/type/integer_type.h>
+
+namespace ionlang {
+    struct Block;
+
+    struct Expression;
+
+    struct Function;
+
+    struct VariableDeclStatement;
+
+    /**
+     * An inclusive range of integer values. Values of unsigned types
+     * are held as they are, thus unsigned 64-bit types have no range.
+     */
+    struct IntegerRange {
+        int64_t min;
+
+        int64_t max;
+
+        /**
+         * The range of all values the type can hold, or std::nullopt
+         * if such range cannot be represented.
+         */
+        [[nodiscard]] static std::optional<IntegerRange> findTypeRange(const IntegerType &type);
+
+        [[nodiscard]] bool contains(const IntegerRange &other) const noexcept;
+
+        [[nodiscard]] bool operator==(const IntegerRange &other) const noexcept;
+
+        [[nodiscard]] bool operator!=(const IntegerRange &other) const noexcept;
+    };
+
+    /**
+     * The ranges of the integer locals and values within a function.
+     * The range of a local covers every value it is ever assigned,
+     * regardless of where it is read. Operations whose range exceeds
+     * their type may overflow, and take on the type's whole range.
+     */
+    class IntegerRanges {
+    private:
+        /**
+         * Locals whose range keeps growing after this amount of rounds
+         * take on their type's whole range.
+         */
+        static constexpr uint32_t maxRounds = 8;
+
+        std::unordered_map<const Construct *, IntegerRange> ranges;
+
+        std::unordered_set<const Construct *> overflows;
+
+        /**
+         * The values assigned to locals (including their initial value),
+         * in the order they appear.
+         */
+        static void collectDefinitions(
+            Block *block,
+            std::vector<std::pair<VariableDeclStatement *, Construct *>> &definitions
+        );
+
+        /**
+         * Compute the range of the value, recording the ranges of the
+         * value and its operands if requested.
+         */
+        std::optional<IntegerRange> evaluate(Construct *value, bool isRecorded);
+
+        std::optional<IntegerRange> evaluateOperation(Expression *expression, bool isRecorded);
+
+    public:
+        [[nodiscard]] static IntegerRanges build(Function *function);
+
+        IntegerRanges();
+
+        /**
+         * The range of the local or value, if it is an integer.
+         */
+        [[nodiscard]] std::optional<IntegerRange> findRange(const Construct *construct) const;
+
+        /**
+         * Whether the operation may overflow. Operations whose range
+         * is unknown may overflow as far as the analysis can tell.
+         */
+        [[nodiscard]] bool mayOverflow(const Construct *operation) const;
+    };
+
+    struct RangeAnalysis {
+        typedef IntegerRanges Result;
+
+        static constexpr AnalysisDependency dependency = AnalysisDependency::Tree;
+
+        [[nodiscard]] static Result run(Construct *construct, AnalysisManager &analysisManager);
+    };
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include <ionlang/analysis/analysis_manager.h>
+#include <ionlang/construct/module.h>
+
+namespace ionlang {
+    /**
+     * The top-level constructs (functions, externs and globals) of a
+     * module which are reachable from its roots, following resolved
+     * references. Roots are the entry point, and any construct annotated
+     * with the keep or export attribute.
+     */
+    struct ReachabilityAnalysis {
+        typedef std::unordered_set<const Construct *> Result;
+
+        static constexpr AnalysisDependency dependency = AnalysisDependency::Tree;
+
+        static constexpr std::string_view entryPointName = "main";
+
+        static constexpr std::string_view keepAttributeName = "keep";
+
+        static constexpr std::string_view exportAttributeName = "export";
+
+        /**
+         * Whether the construct is a function, extern or global, which
+         * are the only constructs subject to reachability.
+         */
+        [[nodiscard]] static bool isTracked(const Construct *construct) noexcept;
+
+        [[nodiscard]] static bool isRoot(Construct *construct);
+
+        /**
+         * Collect the constructs reachable from the module's roots, plus
+         * the top-level constructs named by the additional root names.
+         */
+        [[nodiscard]] static Result collect(Module *module, const std::vector<std::string> &rootNames = {});
+
+        [[nodiscard]] static Result run(Construct *construct, AnalysisManager &analysisManager);
+    };
+}
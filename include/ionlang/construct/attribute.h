@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string_view>
 #include <ionshared/misc/helpers.h>
 #include <ionshared/misc/named.h>
 #include <ionlang/construct/pseudo/child_construct.h>
@@ -14,4 +15,18 @@ namespace ionlang {
     };
 
     typedef std::vector<ionshared::Ptr<Attribute>> Attributes;
+
+    /**
+     * A construct which may be annotated with attributes (ex. '@keep').
+     */
+    struct Attributable {
+        Attributes attributes = {};
+
+        [[nodiscard]] bool hasAttribute(std::string_view name) const noexcept;
+
+        /**
+         * Take on the attributes, making the owner their parent.
+         */
+        void setAttributes(const ionshared::Ptr<Construct> &owner, Attributes attributes);
+    };
 }
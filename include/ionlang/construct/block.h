@@ -3,9 +3,8 @@
 #include <string>
 #include <ionshared/misc/named.h>
 #include <ionshared/misc/helpers.h>
-#include <ionshared/tracking/symbol_table.h>
-#include <ionshared/tracking/scoped.h>
 #include <ionlang/construct/pseudo/child_construct.h>
+#include <ionlang/tracking/flat_symbol_table.h>
 #include "ionlang/construct/statement/variable_decl_statement.h"
 #include "statement.h"
 #include "function.h"
@@ -16,22 +15,33 @@ namespace ionlang {
     class StatementBuilder;
 
     // TODO: Must be verified to contain a single terminal instruction at the end?
-    struct Block : ConstructWithParent<>, ionshared::Scoped<VariableDeclStatement> {
+    struct Block : ConstructWithParent<> {
         // TODO: When statements are mutated, the symbol table must be cleared and re-populated.
         std::vector<ionshared::Ptr<Statement>> statements;
 
+        PtrFlatSymbolTable<VariableDeclStatement> symbolTable;
+
         explicit Block(
             ionshared::Ptr<Construct> parent,
 
             std::vector<ionshared::Ptr<Statement>> statements = {},
 
-            const ionshared::PtrSymbolTable<VariableDeclStatement> &symbolTable =
-                ionshared::util::makePtrSymbolTable<VariableDeclStatement>()
+            PtrFlatSymbolTable<VariableDeclStatement> symbolTable =
+                util::makePtrFlatSymbolTable<VariableDeclStatement>()
         );
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        /**
+         * Replace a statement with another one in the same position. The
+         * replacement must be a statement; its parent is set to this block
+         * and it is registered on the local symbol table if applicable.
+         */
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
 
         /**
          * Append a statement to the local statement vector, and if
@@ -46,14 +56,37 @@ namespace ionlang {
          * to another. The statement will be removed from the local vector,
          * and registered on the target block's symbol table.
          */
-        bool relocateStatement(size_t orderIndex, ionshared::Ptr<Block> target);
+        bool relocateStatement(size_t orderIndex, const ionshared::Ptr<Block> &target);
 
+        /**
+         * Move the statements within the provided range (end exclusive, or
+         * all after the starting index if no end index was provided) to the
+         * end of the target block, in a single pass. Their symbol table
+         * entries are moved along, and their parent is set to the target.
+         * Returns the amount of statements relocated.
+         */
         size_t relocateStatements(
             const ionshared::Ptr<Block> &target,
             size_t from = 0,
             std::optional<size_t> to = std::nullopt
         );
 
+        /**
+         * Insert the statements before the statement at the provided order
+         * index (or at the end, if the index equals the amount of statements),
+         * setting their parent to this block and registering them on the
+         * local symbol table if applicable.
+         */
+        void insertStatements(size_t orderIndex, const std::vector<ionshared::Ptr<Statement>> &statements);
+
+        /**
+         * Remove the statements within the provided range (end exclusive,
+         * or all after the starting index if no end index was provided),
+         * along with their symbol table entries. Returns the amount of
+         * statements removed.
+         */
+        size_t removeStatements(size_t from, std::optional<size_t> to = std::nullopt);
+
         /**
          * Splits the local basic block, relocating all instructions
          * within the provided range (or all after the starting index if
@@ -88,5 +121,17 @@ namespace ionlang {
         [[nodiscard]] bool isFunctionBody();
 
         [[nodiscard]] ionshared::OptPtr<Function> findParentFunction();
+
+    private:
+        /**
+         * Register the statement on the local symbol table, if applicable.
+         */
+        void registerStatement(const ionshared::Ptr<Statement> &statement);
+
+        /**
+         * Remove the statement's local symbol table entry, unless it
+         * is shadowed by another declaration.
+         */
+        void unregisterStatement(const ionshared::Ptr<Statement> &statement);
     };
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <ionshared/tracking/symbol_table.h>
 #include <ionshared/construct/base_construct.h>
 #include <ionshared/diagnostics/source_location.h>
@@ -45,8 +47,12 @@ namespace ionlang {
 
     class Pass;
 
+    class TypeContext;
+
     typedef ionshared::Ast<Construct> Ast;
 
+    typedef std::function<void(Construct *)> ChildCallback;
+
     struct Construct : ionshared::BaseConstruct<Construct, ConstructKind> {
         template<class T>
         static Ast convertChildren(std::vector<ionshared::Ptr<T>> vector) {
@@ -89,6 +95,19 @@ namespace ionlang {
 
         std::optional<ionshared::SourceLocation> sourceLocation;
 
+        /**
+         * The amount of modifications made to this construct so far,
+         * used to tell whether cached analysis results are stale.
+         */
+        uint64_t version;
+
+        /**
+         * The amount of modifications made within the tree rooted at this
+         * construct so far. Only bumped while the construct is a root
+         * (usually a module), see getTreeVersion().
+         */
+        std::atomic<uint64_t> treeVersion;
+
         explicit Construct(ConstructKind kind,
             std::optional<ionshared::SourceLocation> sourceLocation = std::nullopt,
             ionshared::OptPtr<Construct> parent = std::nullopt
@@ -96,6 +115,46 @@ namespace ionlang {
 
         virtual void accept(Pass &visitor) = 0;
 
+        /**
+         * Downcast to a non-owning pointer of the derived type. Unlike
+         * staticCast(), the reference count is not touched. The caller
+         * must know the derived type beforehand (ex. from a kind tag).
+         */
+        template<class T>
+        [[nodiscard]] T *rawCast() noexcept {
+            return static_cast<T *>(this);
+        }
+
+        /**
+         * Invoke the callback on each of the construct's children in
+         * order, directly from where they are stored. Unlike getChildNodes(),
+         * no intermediate vector is built and no ownership is shared. Constructs
+         * with children must override this method, and must not yield
+         * nullptr for optional members which are not set.
+         */
+        virtual void forEachChild(const ChildCallback &callback);
+
+        /**
+         * Replace the given direct child with another construct, in the
+         * slot the child is stored in. Returns false if the construct does
+         * not hold the child, or if the slot cannot hold the replacement.
+         * Constructs with replaceable children must override this method.
+         */
+        virtual bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement);
+
+        /**
+         * Drop the construct's hold on its children, leaving it empty.
+         * Used by teardown() once it has taken over the children, so
+         * that freeing the construct does not recurse into them.
+         * Constructs which may nest (ex. blocks, statements and values)
+         * must override this method.
+         */
+        virtual void releaseChildren();
+
+        /**
+         * Collect the construct's children into a new vector. Prefer
+         * forEachChild() on hot paths, as this allocates.
+         */
         [[nodiscard]] virtual Ast getChildNodes();
 
         /**
@@ -107,5 +166,64 @@ namespace ionlang {
         [[nodiscard]] virtual bool verify();
 
         [[nodiscard]] std::optional<std::string> findConstructName();
+
+        /**
+         * Take the construct's subtree apart, so that it is freed once its
+         * last owner releases it. Resolved references may point back into
+         * an enclosing construct (ex. a recursive call), thus these are
+         * left unresolved. Children which are not owned elsewhere (unlike
+         * ex. interned types) are then detached and freed one by one
+         * instead of by recursive destructors, which would overflow the
+         * stack on deeply nested trees. The construct is left empty.
+         */
+        void teardown();
+
+        /**
+         * Record that the construct was mutated. Mutator methods (ex.
+         * Block::appendStatement()) invoke this on their own; code which
+         * modifies members directly must invoke it afterwards. Bumps the
+         * version of the construct, and the tree version of its root.
+         */
+        void markModified() noexcept;
+
+        /**
+         * Find the construct holding this one, if it keeps a link to it.
+         * Constructs created detached, and modules, have no parent.
+         */
+        [[nodiscard]] virtual Construct *findParent() noexcept;
+
+        /**
+         * Walk up the parent links to the root of the construct's tree,
+         * which is the construct itself if it has no parent.
+         */
+        [[nodiscard]] Construct *findTreeRoot() noexcept;
+
+        /**
+         * Get the amount of modifications made within the construct's
+         * tree so far, as counted on its root. Modifying another tree
+         * (ex. another module) leaves this version untouched.
+         */
+        [[nodiscard]] uint64_t getTreeVersion() noexcept;
+
+        /**
+         * Find the type context of the module the construct belongs to.
+         * Constructs outside of any module use the default context, like
+         * the type factory does.
+         */
+        [[nodiscard]] ionshared::Ptr<TypeContext> findTypeContext() noexcept;
+
+        /**
+         * Link the given child back to the construct if it is an expression,
+         * along with the expressions nested within it. Expressions receive
+         * no parent upon creation, therefore constructs holding values must
+         * invoke this whenever one is attached to them, so that modifying
+         * the expression reaches the owning tree.
+         */
+        void adoptValue(Construct *child);
+
+        /**
+         * Adopt each of the construct's direct children, see adoptValue().
+         */
+        void adoptValues();
     };
 }
@@ -11,14 +11,25 @@ namespace ionlang {
 
         UnaryOperation,
 
-        BinaryOperation
+        BinaryOperation,
+
+        VariableRef
     };
 
     struct Expression : public Value<> {
         const ExpressionKind expressionKind;
 
+        /**
+         * Non-owning link to the construct holding the expression (ex. a
+         * statement or another expression). Set once the expression is
+         * attached, see Construct::adoptValue().
+         */
+        std::weak_ptr<Construct> parent;
+
         Expression(ExpressionKind kind, ionshared::Ptr<Type> type);
 
         void accept(Pass &visitor) override;
+
+        [[nodiscard]] Construct *findParent() noexcept override;
     };
 }
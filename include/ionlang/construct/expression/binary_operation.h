@@ -27,17 +27,23 @@ namespace ionlang {
     public:
         explicit BinaryOperation(const BinaryOperationOpts &opts);
 
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
+
         [[nodiscard]] Operator getOperator() const noexcept;
 
         void setOperator(Operator operation) noexcept;
 
         [[nodiscard]] ionshared::Ptr<Construct> getLeftSide() const noexcept;
 
-        void setLeftSide(ionshared::Ptr<Construct> leftSide) noexcept;
+        void setLeftSide(ionshared::Ptr<Construct> leftSide);
 
         [[nodiscard]] ionshared::OptPtr<Construct> getRightSide() const noexcept;
 
-        void setRightSide(ionshared::OptPtr<Construct> rightSide) noexcept;
+        void setRightSide(ionshared::OptPtr<Construct> rightSide);
 
         [[nodiscard]] bool hasRightSide() const noexcept;
     };
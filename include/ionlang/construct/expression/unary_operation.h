@@ -20,7 +20,20 @@ namespace ionlang {
 
         LessThan,
 
-        GreaterThan
+        GreaterThan,
+
+        /**
+         * The operators below have no syntax of their own, and are
+         * only introduced by passes (ex. by strength reduction).
+         */
+        ShiftLeft,
+
+        /**
+         * Arithmetic for signed operands, logical for unsigned ones.
+         */
+        ShiftRight,
+
+        BitwiseAnd
     };
 
     class UnaryOperation : public Expression {
@@ -36,12 +49,18 @@ namespace ionlang {
             ionshared::Ptr<Construct> value
         );
 
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
+
         [[nodiscard]] Operator getOperator() const noexcept;
 
         void setOperator(Operator operation) noexcept;
 
         [[nodiscard]] ionshared::Ptr<Construct> getValue() const noexcept;
 
-        void setValue(ionshared::Ptr<Construct> value) noexcept;
+        void setValue(ionshared::Ptr<Construct> value);
     };
 }
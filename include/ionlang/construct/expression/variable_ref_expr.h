@@ -15,6 +15,8 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
+        void forEachChild(const ChildCallback &callback) override;
+
         [[nodiscard]] PtrRef<VariableDeclStatement> getVariableDecl() const noexcept;
 
         void setVariableDecl(PtrRef<VariableDeclStatement> variableDecl) noexcept;
@@ -1,13 +1,14 @@
 #pragma once
 
 #include <ionlang/construct/pseudo/child_construct.h>
+#include "attribute.h"
 #include "prototype.h"
 #include "module.h"
 
 namespace ionlang {
     class Pass;
 
-    struct Extern : ConstructWithParent<Module> {
+    struct Extern : ConstructWithParent<Module>, Attributable {
         ionshared::Ptr<Prototype> prototype;
 
         Extern(
@@ -17,6 +18,6 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
     };
 }
@@ -2,6 +2,7 @@
 
 #include <ionshared/misc/helpers.h>
 #include <ionlang/tracking/local_var_descriptor.h>
+#include "attribute.h"
 #include "construct.h"
 #include "prototype.h"
 #include "module.h"
@@ -9,7 +10,7 @@
 namespace ionlang {
     class Pass;
 
-    struct Function : ConstructWithParent<Module> {
+    struct Function : ConstructWithParent<Module>, Attributable {
         ionshared::Ptr<Prototype> prototype;
 
         ionshared::Ptr<Block> body;
@@ -24,6 +25,8 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
     };
 }
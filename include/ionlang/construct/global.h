@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 #include <ionshared/misc/helpers.h>
+#include "attribute.h"
 #include "value.h"
 #include "construct.h"
 #include "type.h"
@@ -10,7 +11,7 @@
 namespace ionlang {
     class Pass;
 
-    struct Global : ConstructWithParent<Module>, ionshared::Named {
+    struct Global : ConstructWithParent<Module>, ionshared::Named, Attributable {
         ionshared::Ptr<Type> type;
 
         ionshared::OptPtr<Value<>> value;
@@ -24,6 +25,10 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
     };
 }
@@ -3,6 +3,8 @@
 #include <ionshared/misc/named.h>
 #include <ionshared/tracking/scoped.h>
 #include <ionshared/tracking/context.h>
+#include <ionlang/tracking/flat_symbol_table.h>
+#include <ionlang/type_system/type_context.h>
 #include "construct.h"
 
 namespace ionlang {
@@ -15,13 +17,39 @@ namespace ionlang {
     struct Module : Construct, ionshared::Named {
         ionshared::Ptr<Context> context;
 
+        /**
+         * The module's top-level constructs (functions, externs, globals
+         * and structs), in declaration order.
+         */
+        PtrFlatSymbolTable<Construct> symbolTable;
+
+        /**
+         * The references within the module which are yet to be resolved,
+         * as collected by the parser. Allows resolving references without
+         * walking the whole tree. Modules which were not parsed have no
+         * such worklist.
+         */
+        std::optional<Ast> pendingRefs;
+
+        /**
+         * The context the module's built-in types were interned on (ex.
+         * by the parser). Types created for the module later on (ex. by
+         * passes) must be obtained from it as well, so that they remain
+         * comparable by identity.
+         */
+        ionshared::Ptr<TypeContext> typeContext;
+
         explicit Module(
             std::string id,
-            ionshared::Ptr<Context> context = std::make_shared<Context>()
+            ionshared::Ptr<Context> context = std::make_shared<Context>(),
+            PtrFlatSymbolTable<Construct> symbolTable = util::makePtrFlatSymbolTable<Construct>(),
+            ionshared::Ptr<TypeContext> typeContext = TypeContext::getDefault()
         );
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
     };
 }
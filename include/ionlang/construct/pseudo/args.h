@@ -3,20 +3,25 @@
 #include <utility>
 #include <string>
 #include <ionshared/misc/helpers.h>
-#include <ionshared/tracking/symbol_table.h>
 #include <ionlang/construct/type.h>
+#include <ionlang/tracking/flat_symbol_table.h>
 
 namespace ionlang {
     typedef std::pair<ionshared::Ptr<Type>, std::string> Arg;
 
     struct Args {
-        ionshared::Ptr<ionshared::SymbolTable<Arg>> items;
+        /**
+         * The parameters by name, iterated in declaration order (see
+         * FlatSymbolTable::forEach()), which is also the order arguments
+         * are bound in.
+         */
+        ionshared::Ptr<FlatSymbolTable<Arg>> items;
 
         bool isVariable;
 
         explicit Args(
-            ionshared::Ptr<ionshared::SymbolTable<Arg>> items =
-                std::make_shared<ionshared::SymbolTable<Arg>>(),
+            ionshared::Ptr<FlatSymbolTable<Arg>> items =
+                std::make_shared<FlatSymbolTable<Arg>>(),
 
             bool isVariable = false
         );
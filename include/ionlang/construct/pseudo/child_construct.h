@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <ionshared/misc/helpers.h>
 #include <ionlang/construct/construct.h>
 
@@ -13,17 +14,36 @@ namespace ionlang {
     template<class T = Construct>
         // TODO: Require T : Construct.
     struct ConstructWithParent : Construct {
-        ConstructWithParent(ionshared::Ptr<T> parent, ConstructKind kind) :
-            Construct(kind, std::nullopt, parent) {
+        /**
+         * Non-owning link to the parent. Parents own their children,
+         * so a strong link here would form a cycle and the tree would
+         * never be freed. The parent of a construct attached to a tree
+         * always outlives it.
+         */
+        std::weak_ptr<T> parent;
+
+        ConstructWithParent(const ionshared::Ptr<T> &parent, ConstructKind kind) :
+            Construct(kind),
+            parent(parent) {
             //
         }
 
+        [[nodiscard]] bool hasParent() const noexcept {
+            return !this->parent.expired();
+        }
+
+        [[nodiscard]] Construct *findParent() noexcept override {
+            return this->parent.lock().get();
+        }
+
         [[nodiscard]] ionshared::Ptr<T> getUnboxedParent() {
-            if (!ionshared::util::hasValue(this->parent)) {
+            ionshared::Ptr<T> parent = this->parent.lock();
+
+            if (parent == nullptr) {
                 throw std::runtime_error("Parent is nullptr");
             }
 
-            return this->parent->get()->template dynamicCast<T>();
+            return parent;
         }
     };
 }
@@ -21,7 +21,11 @@ namespace ionlang {
 
     template<typename T = Construct>
     struct Ref : public Construct, public ionshared::Named {
-        ionshared::Ptr<Construct> owner;
+        /**
+         * Non-owning, as the reference usually lives within its owner's
+         * subtree.
+         */
+        std::weak_ptr<Construct> owner;
 
         const RefKind refKind;
 
@@ -36,7 +40,7 @@ namespace ionlang {
         ) :
             Construct(ConstructKind::Ref),
             Named{id},
-            owner(std::move(scope)),
+            owner(scope),
             refKind(kind),
             value(value) {
             //
@@ -68,7 +72,7 @@ namespace ionlang {
         }
 
         void removeValue() noexcept {
-            this->resolve(std::nullopt);
+            this->value = std::nullopt;
         }
 
         [[nodiscard]] bool isResolved() noexcept {
@@ -25,6 +25,10 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
     };
 }
@@ -19,10 +19,14 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
 
         [[nodiscard]] ionshared::Ptr<Expression> getExpression() const noexcept;
 
-        void setExpression(ionshared::Ptr<Expression> expression) noexcept;
+        void setExpression(ionshared::Ptr<Expression> expression);
     };
 }
@@ -24,5 +24,11 @@ namespace ionlang {
         explicit VariableDeclStatement(const VariableDeclStatementOpts &opts);
 
         void accept(Pass &visitor) override;
+
+        void forEachChild(const ChildCallback &callback) override;
+
+        void releaseChildren() override;
+
+        bool replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) override;
     };
 }
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <string_view>
 #include <ionshared/misc/named.h>
+#include <ionlang/tracking/flat_symbol_table.h>
 #include "construct.h"
 
 namespace ionlang {
     class Pass;
 
-    typedef ionshared::PtrSymbolTable<Type> Fields;
+    typedef PtrFlatSymbolTable<Type> Fields;
 
     struct Struct : ConstructWithParent<Module>, ionshared::Named {
         Fields fields;
@@ -19,11 +21,11 @@ namespace ionlang {
 
         void accept(Pass &visitor) override;
 
-        [[nodiscard]] Ast getChildNodes() override;
+        void forEachChild(const ChildCallback &callback) override;
 
-        [[nodiscard]] bool containsField(std::string name) const;
+        [[nodiscard]] bool containsField(std::string_view name) const;
 
-        [[nodiscard]] ionshared::OptPtr<Type> lookupField(std::string name);
+        [[nodiscard]] ionshared::OptPtr<Type> lookupField(std::string_view name);
 
         void setField(std::string name, ionshared::Ptr<Type> field);
     };
@@ -30,9 +30,21 @@ namespace ionlang {
     typedef ionshared::Set<TypeQualifier> TypeQualifiers;
 
     struct Type : public Construct, public ionshared::Named {
+    private:
+        /**
+         * Not exposed, as the set is shared by the canonical instances
+         * of interned types.
+         */
+        ionshared::Ptr<TypeQualifiers> qualifiers;
+
+    public:
         const TypeKind typeKind;
 
-        ionshared::Ptr<TypeQualifiers> qualifiers;
+        /**
+         * Whether this is the canonical instance handed out by a type
+         * context. Interned types are shared and must not be mutated.
+         */
+        bool isInterned;
 
         explicit Type(
             std::string id,
@@ -44,10 +56,25 @@ namespace ionlang {
 
         [[nodiscard]] TypeKind getTypeKind() const noexcept;
 
-        [[nodiscard]] bool addQualifier(TypeQualifier qualifier) noexcept;
+        /**
+         * Qualify the type in place. Interned types are rejected, their
+         * qualified variants must be obtained from their type context
+         * instead (see TypeContext::getQualifiedType()).
+         */
+        [[nodiscard]] bool addQualifier(TypeQualifier qualifier);
 
-        [[nodiscard]] bool removeQualifier(TypeQualifier qualifier) noexcept;
+        /**
+         * Unqualify the type in place. Interned types are rejected,
+         * like with addQualifier().
+         */
+        [[nodiscard]] bool removeQualifier(TypeQualifier qualifier);
 
         [[nodiscard]] bool hasQualifier(TypeQualifier qualifier) const;
+
+        /**
+         * The type's qualifier set, or nullptr if it has none. Read-only,
+         * as it may be shared by other types.
+         */
+        [[nodiscard]] const TypeQualifiers *getQualifiers() const noexcept;
     };
 }
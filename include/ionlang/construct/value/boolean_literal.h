@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ionlang/construct/type/boolean_type.h>
 #include <ionlang/construct/value.h>
 
 namespace ionlang {
@@ -8,8 +9,13 @@ namespace ionlang {
     struct BooleanLiteral : Value<> {
         bool value;
 
+        /**
+         * The type is taken from the default type context.
+         */
         explicit BooleanLiteral(bool value);
 
+        BooleanLiteral(bool value, ionshared::Ptr<BooleanType> type);
+
         void accept(Pass &visitor) override;
     };
 }
@@ -57,10 +57,45 @@ namespace ionlang::diagnostic {
         std::nullopt
     );
 
+    IONLANG_NOTICE_DEFINE(
+        semanticUndefinedReference,
+        ionshared::DiagnosticType::Error,
+        "Undefined reference to '%s'",
+        std::nullopt
+    );
+
     IONLANG_NOTICE_DEFINE(
         structFieldRedefinition,
         ionshared::DiagnosticType::Error,
         "Field '%s' in struct '%s' was already previously defined",
         std::nullopt
     );
+
+    IONLANG_NOTICE_DEFINE(
+        semanticDivisionByZero,
+        ionshared::DiagnosticType::Error,
+        "Division by zero in constant expression",
+        std::nullopt
+    );
+
+    IONLANG_NOTICE_DEFINE(
+        semanticConstantOverflow,
+        ionshared::DiagnosticType::Warning,
+        "Constant expression overflows its type and wraps around",
+        std::nullopt
+    );
+
+    IONLANG_NOTICE_DEFINE(
+        semanticUnreachableCode,
+        ionshared::DiagnosticType::Warning,
+        "Unreachable code after terminal statement",
+        std::nullopt
+    );
+
+    IONLANG_NOTICE_DEFINE(
+        syntaxAttributesIgnored,
+        ionshared::DiagnosticType::Warning,
+        "Attributes cannot be applied to this construct and are ignored",
+        std::nullopt
+    );
 }
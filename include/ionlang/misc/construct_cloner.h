@@ -0,0 +1,72 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/construct/pseudo/ref.h>
+#include <ionlang/construct/statement.h>
+#include <ionlang/construct/block.h>
+
+namespace ionlang {
+    /**
+     * Deep-copies statements and values, so that a copy may be attached
+     * elsewhere in the tree. Resolved references to declarations within
+     * the copied subtree are redirected to their copies, while references
+     * to declarations outside of it are kept as they are. Types are
+     * immutable, and thus shared.
+     */
+    class ConstructCloner {
+    public:
+        typedef std::function<std::string(const std::string &)> Renamer;
+
+    private:
+        Renamer renamer;
+
+        std::unordered_map<const VariableDeclStatement *, ionshared::Ptr<VariableDeclStatement>> declarations;
+
+        std::unordered_map<std::string, ionshared::Ptr<VariableDeclStatement>> bindings;
+
+        [[nodiscard]] PtrRef<VariableDeclStatement> cloneVariableRef(
+            Ref<VariableDeclStatement> *ref,
+            const ionshared::Ptr<Block> &scope
+        );
+
+    public:
+        /**
+         * The renamer is given the name of each copied declaration, and
+         * provides the name of its copy. Names are kept by default.
+         */
+        explicit ConstructCloner(Renamer renamer = nullptr);
+
+        /**
+         * Resolve copies of unresolved variable references with the given
+         * name to the declaration (ex. to bind a function's parameters).
+         */
+        void bind(const std::string &name, ionshared::Ptr<VariableDeclStatement> variableDecl);
+
+        /**
+         * The copy of the declaration made so far, if any.
+         */
+        [[nodiscard]] ionshared::OptPtr<VariableDeclStatement> findCopy(const VariableDeclStatement *variableDecl) const;
+
+        /**
+         * Copy a literal or an expression. References within are scoped
+         * to the given block. Returns nullptr if the value or any of its
+         * children cannot be copied.
+         */
+        [[nodiscard]] ionshared::Ptr<Construct> cloneValue(Construct *value, const ionshared::Ptr<Block> &scope);
+
+        /**
+         * Copy a statement, making the given block its parent. Returns
+         * nullptr if the statement or any of its children cannot be copied.
+         */
+        [[nodiscard]] ionshared::Ptr<Statement> cloneStatement(Statement *statement, const ionshared::Ptr<Block> &parent);
+
+        /**
+         * Copy a block along with its statements. Returns nullptr if any
+         * of its statements cannot be copied.
+         */
+        [[nodiscard]] ionshared::Ptr<Block> cloneBlock(Block *block, const ionshared::Ptr<Construct> &parent);
+    };
+}
@@ -5,7 +5,11 @@
 #include <ionlang/construct/construct.h>
 
 namespace ionlang {
-    typedef ionshared::Map<ionshared::Ptr<Construct>, ionshared::Ptr<ionir::Construct>> ConstructSymbolTable;
+    /**
+     * Keyed by non-owning pointers, as the emitted entities must not keep
+     * the source constructs alive; the AST owns them.
+     */
+    typedef ionshared::Map<const Construct *, ionshared::Ptr<ionir::Construct>> ConstructSymbolTable;
 
     class IonIrEmittedEntities {
     private:
@@ -15,15 +19,15 @@ namespace ionlang {
         IonIrEmittedEntities();
 
         void set(
-            const ionshared::Ptr<Construct> &key,
+            const Construct *key,
             const ionshared::Ptr<ionir::Construct> &value
         );
 
-        [[nodiscard]] bool contains(ionshared::Ptr<Construct> key) const;
+        [[nodiscard]] bool contains(const Construct *key) const;
 
         template<typename T = ionir::Construct>
         [[nodiscard]] std::optional<ionshared::Ptr<T>> find(
-            const ionshared::Ptr<Construct> &construct
+            const Construct *construct
         ) {
             if (this->contains(construct)) {
                 ionshared::Ptr<T> castResult = this->entities.lookup(construct)->get()->dynamicCast<T>();
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/construct/construct.h>
+#include <ionlang/construct/statement.h>
+#include <ionlang/construct/expression.h>
+#include <ionlang/construct/type.h>
+
+namespace ionlang {
+    struct MemoryUsage {
+        size_t nodeCount = 0;
+
+        size_t bytes = 0;
+
+        void add(size_t bytes) noexcept;
+    };
+
+    /**
+     * A breakdown of the memory held by an AST, by kind of construct.
+     * Each node's bytes consist of its object, the allocation overhead of
+     * its shared pointer, and the heap memory it owns directly (ex. names,
+     * statement vectors and symbol tables). Nodes reachable through more
+     * than one path (ex. interned types) are only counted once. Sizes of
+     * ionshared containers are estimated.
+     */
+    struct MemoryReport {
+        /**
+         * Collect the report for the given root and every node within it.
+         */
+        [[nodiscard]] static MemoryReport collect(const ionshared::Ptr<Construct> &root);
+
+        MemoryUsage total;
+
+        std::map<ConstructKind, MemoryUsage> byConstructKind;
+
+        std::map<StatementKind, MemoryUsage> byStatementKind;
+
+        std::map<ValueKind, MemoryUsage> byValueKind;
+
+        std::map<ExpressionKind, MemoryUsage> byExpressionKind;
+
+        std::map<TypeKind, MemoryUsage> byTypeKind;
+
+        /**
+         * The amount of places referring to a type.
+         */
+        size_t typeReferenceCount = 0;
+
+        /**
+         * Type objects referred to from more than one place.
+         */
+        size_t sharedTypeCount = 0;
+
+        /**
+         * Type objects referred to from a single place only. These are
+         * candidates for interning.
+         */
+        size_t uniqueTypeCount = 0;
+
+        /**
+         * Format the report as a human-readable table.
+         */
+        [[nodiscard]] std::string format() const;
+    };
+}
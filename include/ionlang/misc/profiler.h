@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace ionlang {
+    struct ProfileEvent {
+        std::string name;
+
+        /**
+         * The kind of work measured (ex. "phase" or "pass").
+         */
+        std::string category;
+
+        std::thread::id threadId;
+
+        /**
+         * Relative to the creation of the profiler.
+         */
+        uint64_t startMicroseconds;
+
+        uint64_t wallMicroseconds;
+
+        /**
+         * Process CPU time (user and system) spent meanwhile, by all
+         * threads. May exceed the wall time during parallel work.
+         */
+        uint64_t cpuMicroseconds;
+
+        uint64_t nodeCount;
+
+        /**
+         * How far the peak resident memory of the process rose meanwhile.
+         * Zero unless the high-water mark was raised, therefore memory
+         * freed and allocated again within the scope is not reflected.
+         */
+        uint64_t peakMemoryGrowthBytes;
+    };
+
+    /**
+     * Collects timing events of compilation phases and passes. Profiling
+     * is off by default, in which case measuring costs a single atomic
+     * load per scope. Events may be recorded from several threads.
+     */
+    class Profiler {
+    private:
+        std::atomic<bool> isEnabled;
+
+        std::chrono::steady_clock::time_point epoch;
+
+        mutable std::mutex mutex;
+
+        std::vector<ProfileEvent> events;
+
+    public:
+        /**
+         * If set, the default profiler is enabled from the start.
+         */
+        static constexpr const char *environmentVariable = "IONLANG_PROFILE";
+
+        [[nodiscard]] static Profiler &getDefault();
+
+        /**
+         * Process CPU time (user and system) spent so far.
+         */
+        [[nodiscard]] static uint64_t readCpuMicroseconds();
+
+        /**
+         * The peak resident memory of the process so far (its lifetime
+         * high-water mark, not specific to any scope), or zero if
+         * unsupported by the platform.
+         */
+        [[nodiscard]] static uint64_t readPeakMemoryBytes();
+
+        explicit Profiler(bool isEnabled = false);
+
+        [[nodiscard]] bool getIsEnabled() const noexcept {
+            return this->isEnabled.load(std::memory_order_relaxed);
+        }
+
+        void setIsEnabled(bool isEnabled) noexcept;
+
+        [[nodiscard]] uint64_t getElapsedMicroseconds() const;
+
+        void record(ProfileEvent event);
+
+        [[nodiscard]] std::vector<ProfileEvent> getEvents() const;
+
+        void clear();
+
+        /**
+         * Format the events as a human-readable table, aggregating
+         * events of the same name.
+         */
+        [[nodiscard]] std::string formatTable() const;
+
+        /**
+         * Format the events in Chrome's trace event JSON format, which
+         * may be loaded in chrome://tracing or Perfetto.
+         */
+        [[nodiscard]] std::string formatChromeTrace() const;
+    };
+
+    /**
+     * Measures the time between its construction and destruction, and
+     * records it on the profiler if profiling was enabled upon
+     * construction.
+     */
+    class ProfileScope {
+    private:
+        Profiler &profiler;
+
+        bool isActive;
+
+        std::string name;
+
+        std::string category;
+
+        uint64_t startMicroseconds;
+
+        uint64_t startCpuMicroseconds;
+
+        uint64_t startPeakMemoryBytes;
+
+        uint64_t nodeCount;
+
+    public:
+        /**
+         * The name and category are only copied if profiling is enabled.
+         */
+        explicit ProfileScope(
+            std::string_view name,
+            std::string_view category = "phase",
+            Profiler &profiler = Profiler::getDefault()
+        );
+
+        ~ProfileScope();
+
+        ProfileScope(const ProfileScope &) = delete;
+
+        ProfileScope &operator=(const ProfileScope &) = delete;
+
+        [[nodiscard]] bool getIsActive() const noexcept {
+            return this->isActive;
+        }
+
+        void addNodes(uint64_t amount) noexcept {
+            this->nodeCount += amount;
+        }
+    };
+}
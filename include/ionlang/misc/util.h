@@ -6,6 +6,7 @@
 #include <ionlang/construct/expression/unary_operation.h>
 #include <ionlang/construct/type/integer_type.h>
 #include <ionlang/construct/statement.h>
+#include <ionlang/construct/value.h>
 #include <ionlang/lexical/token_kind.h>
 
 namespace ionlang::util {
@@ -21,6 +22,12 @@ namespace ionlang::util {
 
     [[nodiscard]] std::optional<Operator> findOperator(TokenKind tokenKind);
 
+    /**
+     * The amount of heap memory held by the string. Short strings are
+     * stored within the string object itself, and hold none.
+     */
+    [[nodiscard]] size_t getStringHeapBytes(const std::string &value) noexcept;
+
     template<typename ...Args>
     [[nodiscard]] std::runtime_error makeAstError(std::string format, Args &&...args) {
         std::optional<std::string> formattedString =
@@ -33,6 +40,26 @@ namespace ionlang::util {
         return std::runtime_error(*formattedString);
     }
 
+    /**
+     * Cast the construct to a value, or yield nullptr if it is not one.
+     * The cast is static, as literals (ex. 'Value<IntegerType>') do not
+     * derive from 'Value<>'; see castAstPtrResult().
+     */
+    template<typename T = Value<>>
+    [[nodiscard]] ionshared::Ptr<T> tryCastValue(const ionshared::Ptr<Construct> &construct) noexcept {
+        if (construct == nullptr || construct->constructKind != ConstructKind::Value) {
+            return nullptr;
+        }
+
+        return std::static_pointer_cast<T>(construct);
+    }
+
+    /**
+     * Whether the value contains a call, in which case evaluating it
+     * might have side effects.
+     */
+    [[nodiscard]] bool hasCall(Construct *value);
+
     template<typename T = Construct>
     [[nodiscard]] bool hasValue(AstResult<T> result) {
         return std::holds_alternative<T>(result);
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ionlang {
+    /**
+     * A fixed set of worker threads executing batches of indexed tasks.
+     * Each worker owns a queue, from which it takes tasks from the back.
+     * Once its queue is drained, a worker steals tasks from the front of
+     * the other workers' queues, so that uneven tasks are balanced out.
+     */
+    class WorkStealingPool {
+    public:
+        /**
+         * Invoked with the index of the worker running the task and the
+         * index of the task itself. Worker indices are stable and lower
+         * than the worker count, allowing per-worker state.
+         */
+        typedef std::function<void(size_t workerIndex, size_t taskIndex)> Job;
+
+    private:
+        struct WorkerQueue {
+            std::mutex mutex;
+
+            std::deque<size_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+
+        std::condition_variable wakeCondition;
+
+        std::condition_variable doneCondition;
+
+        /**
+         * The job of the batch being run, or nullptr if none. Guarded
+         * by the mutex.
+         */
+        const Job *job;
+
+        size_t generation;
+
+        size_t activeWorkers;
+
+        bool isStopping;
+
+        std::atomic<size_t> pendingTasks;
+
+        std::exception_ptr firstException;
+
+        [[nodiscard]] std::optional<size_t> takeTask(size_t workerIndex);
+
+        void drain(size_t workerIndex, const Job &job);
+
+        void workerMain(size_t workerIndex);
+
+    public:
+        /**
+         * The calling thread of run() acts as the first worker, therefore
+         * only workerCount - 1 threads are spawned. A worker count of zero
+         * uses the hardware concurrency.
+         */
+        explicit WorkStealingPool(size_t workerCount = 0);
+
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+        [[nodiscard]] size_t getWorkerCount() const noexcept;
+
+        /**
+         * Run the job once for each task index within [0, taskCount),
+         * blocking until all tasks are done. If any task throws, the
+         * remaining tasks still run and the first exception is rethrown.
+         * Must not be invoked concurrently, nor from within a task.
+         */
+        void run(size_t taskCount, const Job &job);
+    };
+}
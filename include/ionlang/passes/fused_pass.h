@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Runs several fusible passes within a single traversal. Each node
+     * is handed to every pass in turn, in the order given, so the tree
+     * is only walked once. A pass declining a node's children is no
+     * longer handed any node of that sub-tree, while the traversal goes
+     * on for the other passes. At most one rewrite pass may be fused,
+     * see canFuse().
+     */
+    class FusedPass : public Pass {
+    private:
+        std::vector<ionshared::Ptr<Pass>> passes;
+
+        /**
+         * Made up of the names of the fused passes.
+         */
+        std::string name;
+
+        /**
+         * The depth of the node at which each pass declined to visit
+         * children, or zero if the pass is active.
+         */
+        std::vector<size_t> suppressedDepths;
+
+        /**
+         * The depth of the node currently being visited, starting
+         * at one for the root.
+         */
+        size_t depth;
+
+    public:
+        /**
+         * Whether the pass may join the given passes to be fused. It must
+         * be fusible, and of the same scope. Rewrite passes install their
+         * replacements once the parent is done, so a node rewritten by two
+         * fused rewrite passes would only receive the first replacement.
+         * Such passes are thus not fused together.
+         */
+        [[nodiscard]] static bool canFuse(const std::vector<ionshared::Ptr<Pass>> &passes, const Pass &pass);
+
+        /**
+         * All passes must be fusible with the ones preceding them (see
+         * canFuse()). The fused pass takes on the context and scope of
+         * the first pass.
+         */
+        explicit FusedPass(std::vector<ionshared::Ptr<Pass>> passes);
+
+        [[nodiscard]] const std::vector<ionshared::Ptr<Pass>> &getPasses() const noexcept;
+
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        void mergeStatistics(const Pass &clone) override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        void resetTraversalState() override;
+
+        void visitNode(Construct *node) override;
+
+        [[nodiscard]] bool shouldVisitChildren(Construct *node) override;
+
+        void afterVisitChildren(Construct *node) override;
+    };
+}
@@ -1,11 +1,26 @@
 #pragma once
 
+#include <unordered_map>
+#include <vector>
 #include <ionshared/container/stack.h>
 #include <ionir/construct/basic_block.h>
 #include <ionlang/misc/ionir_emitted_entities.h>
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
+    enum class LoweringMode {
+        /**
+         * Lower every top-level construct of the module.
+         */
+        Eager,
+
+        /**
+         * Only lower the functions, externs and globals which are
+         * reachable from the module's roots. See ReachabilityAnalysis.
+         */
+        Reachable
+    };
+
     class IonIrLoweringPass : public Pass {
     private:
         struct Buffers {
@@ -20,7 +35,7 @@ namespace ionlang {
 
         [[nodiscard]] static ionshared::Ptr<ionir::Type> processTypeQualifiers(
             ionshared::Ptr<ionir::Type> type,
-            const ionshared::Ptr<TypeQualifiers> &qualifiers
+            const Type *qualifiedType
         );
 
         ionshared::PtrSymbolTable<ionir::Module> modules;
@@ -33,8 +48,34 @@ namespace ionlang {
 
         IonIrEmittedEntities symbolTable;
 
+        struct CachedType {
+            /**
+             * Kept alive, so that its address is not reused by another
+             * type (ex. once a module's type context is freed).
+             */
+            ionshared::Ptr<Type> type;
+
+            ionshared::Ptr<ionir::Type> ionIrType;
+        };
+
+        /**
+         * Lowered IonIR types, keyed by their interned (canonical)
+         * counterpart. Non-interned types are not cached, as their
+         * addresses may be reused once they are freed. Cleared upon
+         * visiting each module.
+         */
+        std::unordered_map<const Type *, CachedType> typeCache;
+
         uint32_t nameCounter;
 
+        LoweringMode mode;
+
+        /**
+         * Names of top-level constructs lowered in addition to the
+         * module's own roots, when lowering reachable constructs only.
+         */
+        std::vector<std::string> rootNames;
+
         ionshared::Ptr<ionir::Module> requireModule();
 
         ionshared::Ptr<ionir::Function> requireFunction();
@@ -51,6 +92,14 @@ namespace ionlang {
 
         void lockBuffers(const std::function<void()> &callback);
 
+        /**
+         * Push the previously lowered IonIR type of the given type
+         * onto the type stack, if any. Returns whether it was found.
+         */
+        bool pushCachedType(const Type *type);
+
+        void pushType(Type *type, ionshared::Ptr<ionir::Type> ionIrType);
+
         [[nodiscard]] uint32_t getNameCounter() noexcept;
 
     public:
@@ -63,6 +112,8 @@ namespace ionlang {
 
         ~IonIrLoweringPass();
 
+        [[nodiscard]] std::string_view getPassName() const override;
+
         [[nodiscard]] ionshared::Ptr<ionshared::SymbolTable<ionshared::Ptr<ionir::Module>>> getModules() const;
 
         [[nodiscard]] ionshared::Stack<ionshared::Ptr<ionir::Construct>> getConstructStack() const noexcept;
@@ -73,47 +124,55 @@ namespace ionlang {
 
         bool setModuleBuffer(const std::string &id);
 
+        [[nodiscard]] LoweringMode getMode() const noexcept;
+
+        void setMode(LoweringMode mode) noexcept;
+
+        void addRoot(std::string name);
+
         void visit(ionshared::Ptr<Construct> node) override;
 
-        void visitModule(ionshared::Ptr<Module> node) override;
+        void visitModule(Module *node) override;
+
+        void visitFunction(Function *node) override;
 
-        void visitFunction(ionshared::Ptr<Function> node) override;
+        void visitExtern(Extern *node) override;
 
-        void visitExtern(ionshared::Ptr<Extern> node) override;
+        void visitPrototype(Prototype *node) override;
 
-        void visitPrototype(ionshared::Ptr<Prototype> node) override;
+        void visitBlock(Block *node) override;
 
-        void visitBlock(ionshared::Ptr<Block> node) override;
+        void visitIntegerLiteral(IntegerLiteral *node) override;
 
-        void visitIntegerLiteral(ionshared::Ptr<IntegerLiteral> node) override;
+        void visitCharLiteral(CharLiteral *node) override;
 
-        void visitCharLiteral(ionshared::Ptr<CharLiteral> node) override;
+        void visitStringLiteral(StringLiteral *node) override;
 
-        void visitStringLiteral(ionshared::Ptr<StringLiteral> node) override;
+        void visitBooleanLiteral(BooleanLiteral *node) override;
 
-        void visitBooleanLiteral(ionshared::Ptr<BooleanLiteral> node) override;
+        void visitGlobal(Global *node) override;
 
-        void visitGlobal(ionshared::Ptr<Global> node) override;
+        void visitType(Type *node) override;
 
-        void visitType(ionshared::Ptr<Type> node) override;
+        void visitIntegerType(IntegerType *node) override;
 
-        void visitIntegerType(ionshared::Ptr<IntegerType> node) override;
+        void visitBooleanType(BooleanType *node) override;
 
-        void visitBooleanType(ionshared::Ptr<BooleanType> node) override;
+        void visitVoidType(VoidType *node) override;
 
-        void visitVoidType(ionshared::Ptr<VoidType> node) override;
+        void visitIfStatement(IfStatement *node) override;
 
-        void visitIfStatement(ionshared::Ptr<IfStatement> node) override;
+        void visitReturnStatement(ReturnStatement *node) override;
 
-        void visitReturnStatement(ionshared::Ptr<ReturnStatement> node) override;
+        void visitAssignmentStatement(AssignmentStatement *node) override;
 
-        void visitAssignmentStatement(ionshared::Ptr<AssignmentStatement> node) override;
+        void visitExprWrapperStatement(ExprWrapperStatement *node) override;
 
-        void visitVariableDecl(ionshared::Ptr<VariableDeclStatement> node) override;
+        void visitVariableDecl(VariableDeclStatement *node) override;
 
-        void visitCallExpr(ionshared::Ptr<CallExpr> node) override;
+        void visitCallExpr(CallExpr *node) override;
 
-        void visitStruct(ionshared::Ptr<Struct> node) override;
+        void visitStruct(Struct *node) override;
 
         // TODO: visitRef() if !isResolved() error, else this->visit(ref->getValue()); Is this a good idea? It may be required for example for if statement condition (if it's a ref). Investigate.
     };
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include <ionshared/diagnostics/diagnostic.h>
+#include <ionshared/diagnostics/diagnostic_builder.h>
 #include <ionshared/misc/helpers.h>
 #include <ionshared/passes/base_pass.h>
-#include <ionshared/passes/base_pass_manager.h>
+#include <ionlang/analysis/analysis_manager.h>
 #include <ionlang/construct/pseudo/ref.h>
 #include <ionlang/construct/pseudo/error_marker.h>
 #include <ionlang/construct/construct.h>
@@ -35,77 +41,228 @@
 #include <ionlang/construct/struct.h>
 
 namespace ionlang {
-    struct Pass : ionshared::BasePass<Construct> {
-        explicit Pass(ionshared::Ptr<ionshared::PassContext> context);
+    enum class PassScope {
+        /**
+         * The pass is run once over each root construct, and may
+         * inspect or modify anything within it.
+         */
+        Module,
+
+        /**
+         * The pass is run separately over each function, and only
+         * inspects or modifies the function it is run over (besides
+         * reading module-level declarations). Such passes may be run
+         * over several functions in parallel, see PassManager.
+         */
+        Function
+    };
 
+    struct Pass : ionshared::BasePass<Construct> {
+        const PassScope passScope;
+
+        /**
+         * Shared between the passes of a pass manager, so that analysis
+         * results computed by one pass are reused by the others.
+         */
+        ionshared::Ptr<AnalysisManager> analysisManager;
+
+        /**
+         * The amount of nodes visited by traverse() so far.
+         */
+        uint64_t visitedNodeCount;
+
+        explicit Pass(
+            ionshared::Ptr<ionshared::PassContext> context,
+            PassScope passScope = PassScope::Module
+        );
+
+        /**
+         * Create a fresh instance of the pass, sharing its context. Used
+         * to give each worker its own instance of function-scoped passes,
+         * which must therefore override this.
+         */
+        [[nodiscard]] virtual ionshared::Ptr<Pass> clone() const;
+
+        /**
+         * Add the statistics gathered by a clone of this pass (ex. the
+         * amount of visited nodes) onto this pass's own, before the clone
+         * is discarded. Passes keeping statistics which override clone()
+         * must override this as well, and invoke the base method.
+         */
+        virtual void mergeStatistics(const Pass &clone);
+
+        /**
+         * Whether the pass may share a single traversal with other passes,
+         * see FusedPass. Fusible passes only act through the per-node hooks
+         * and resetTraversalState(), as their visit() is never invoked when
+         * fused (they do not override it nor traverse by themselves), and
+         * must tolerate other passes visiting each node before them.
+         */
+        [[nodiscard]] virtual bool isFusible() const;
+
+        /**
+         * A human-readable name, used when profiling.
+         */
+        [[nodiscard]] virtual std::string_view getPassName() const;
+
+        /**
+         * Retrieve the analysis manager, creating one for this pass alone
+         * if none was provided.
+         */
+        [[nodiscard]] ionshared::Ptr<AnalysisManager> requireAnalysisManager();
+
+        /**
+         * Report a diagnostic through the context's diagnostic builder,
+         * formatting its message with the given arguments, if any. Clones
+         * of function-scoped passes share their context's builder across
+         * workers, thus reports are serialized.
+         */
+        template<typename ...TArgs>
+        void report(
+            const ionshared::Diagnostic &diagnostic,
+            const std::optional<ionshared::SourceLocation> &sourceLocation,
+            TArgs ...formatArgs
+        ) {
+            std::lock_guard<std::mutex> lock(Pass::diagnosticMutex);
+
+            ionshared::Ptr<ionshared::DiagnosticBuilder> diagnosticBuilder =
+                this->context->diagnosticBuilder->bootstrap(diagnostic);
+
+            if (sourceLocation.has_value()) {
+                diagnosticBuilder->setLocation(*sourceLocation);
+            }
+
+            if constexpr (sizeof...(TArgs) != 0) {
+                diagnosticBuilder->formatMessage(formatArgs...);
+            }
+
+            diagnosticBuilder->finish();
+        }
+
+        /**
+         * Visit the node and all of its children. The traversal is
+         * performed iteratively, see traverse(). This is the only visit
+         * method taking ownership; all others receive non-owning pointers,
+         * as the tree keeps its nodes alive for the whole traversal.
+         */
         virtual void visit(ionshared::Ptr<Construct> node);
 
-        virtual void visitChildren(ionshared::Ptr<Construct> node);
+        /**
+         * Invoked before each traversal started by visit(), including
+         * those of a fused pass, to discard any per-traversal state
+         * left behind (ex. by a traversal which threw).
+         */
+        virtual void resetTraversalState();
 
-        virtual void visitModule(ionshared::Ptr<Module> node);
+        /**
+         * Dispatch a single node to its corresponding visit method,
+         * without visiting any of its children.
+         */
+        virtual void visitNode(Construct *node);
 
-        virtual void visitPrototype(ionshared::Ptr<Prototype> node);
+        virtual void visitChildren(Construct *node);
 
-        virtual void visitExtern(ionshared::Ptr<Extern> node);
+        /**
+         * Walk the sub-tree rooted at the provided node using an explicit
+         * stack instead of recursion, so that very deep ASTs cannot overflow
+         * the call stack. Nodes are visited in pre-order through visitNode(),
+         * and afterVisitChildren() is invoked in post-order once all of a
+         * node's children have been visited. Traversals may be nested.
+         */
+        void traverse(Construct *root);
 
-        virtual void visitBlock(ionshared::Ptr<Block> node);
+        /**
+         * Invoked after a node has been visited. Returning false skips
+         * the node's entire sub-tree.
+         */
+        [[nodiscard]] virtual bool shouldVisitChildren(Construct *node);
 
-        virtual void visitStatement(ionshared::Ptr<Statement> node);
+        /**
+         * Invoked once the node's children (if any) have been visited,
+         * or immediately after the node itself if its children were skipped.
+         */
+        virtual void afterVisitChildren(Construct *node);
 
-        virtual void visitIfStatement(ionshared::Ptr<IfStatement> node);
+        virtual void visitModule(Module *node);
 
-        virtual void visitReturnStatement(ionshared::Ptr<ReturnStatement> node);
+        virtual void visitPrototype(Prototype *node);
 
-        virtual void visitAssignmentStatement(ionshared::Ptr<AssignmentStatement> node);
+        virtual void visitExtern(Extern *node);
 
-        virtual void visitExprWrapperStatement(ionshared::Ptr<ExprWrapperStatement> node);
+        virtual void visitBlock(Block *node);
 
-        virtual void visitBlockWrapperStatement(ionshared::Ptr<BlockWrapperStatement> node);
+        virtual void visitStatement(Statement *node);
 
-        virtual void visitExpression(ionshared::Ptr<Expression> node);
+        virtual void visitIfStatement(IfStatement *node);
 
-        virtual void visitUnaryOperation(ionshared::Ptr<UnaryOperation> node);
+        virtual void visitReturnStatement(ReturnStatement *node);
 
-        virtual void visitBinaryOperation(ionshared::Ptr<BinaryOperation> node);
+        virtual void visitAssignmentStatement(AssignmentStatement *node);
 
-        virtual void visitCallExpr(ionshared::Ptr<CallExpr> node);
+        virtual void visitExprWrapperStatement(ExprWrapperStatement *node);
 
-        virtual void visitVariableRefExpr(ionshared::Ptr<VariableRefExpr> node);
+        virtual void visitBlockWrapperStatement(BlockWrapperStatement *node);
 
-        virtual void visitValue(ionshared::Ptr<Value<>> node);
+        virtual void visitExpression(Expression *node);
 
-        virtual void visitIntegerLiteral(ionshared::Ptr<IntegerLiteral> node);
+        virtual void visitUnaryOperation(UnaryOperation *node);
 
-        virtual void visitCharLiteral(ionshared::Ptr<CharLiteral> node);
+        virtual void visitBinaryOperation(BinaryOperation *node);
 
-        virtual void visitStringLiteral(ionshared::Ptr<StringLiteral> node);
+        virtual void visitCallExpr(CallExpr *node);
 
-        virtual void visitBooleanLiteral(ionshared::Ptr<BooleanLiteral> node);
+        virtual void visitVariableRefExpr(VariableRefExpr *node);
 
-        virtual void visitType(ionshared::Ptr<Type> node);
+        virtual void visitValue(Value<> *node);
 
-        virtual void visitVoidType(ionshared::Ptr<VoidType> node);
+        virtual void visitIntegerLiteral(IntegerLiteral *node);
 
-        virtual void visitBooleanType(ionshared::Ptr<BooleanType> node);
+        virtual void visitCharLiteral(CharLiteral *node);
 
-        virtual void visitRef(PtrRef<> node);
+        virtual void visitStringLiteral(StringLiteral *node);
 
-        virtual void visitFunction(ionshared::Ptr<Function> node);
+        virtual void visitBooleanLiteral(BooleanLiteral *node);
 
-        virtual void visitVariableDecl(ionshared::Ptr<VariableDeclStatement> node);
+        virtual void visitType(Type *node);
 
-        virtual void visitScopeAnchor(ionshared::Ptr<ionshared::Scoped<Construct>> node);
+        virtual void visitVoidType(VoidType *node);
 
-        virtual void visitIntegerType(ionshared::Ptr<IntegerType> node);
+        virtual void visitBooleanType(BooleanType *node);
 
-        virtual void visitGlobal(ionshared::Ptr<Global> node);
+        virtual void visitRef(Ref<> *node);
 
-        virtual void visitErrorMarker(ionshared::Ptr<ErrorMarker> node);
+        virtual void visitFunction(Function *node);
 
-        virtual void visitAttribute(ionshared::Ptr<Attribute> node);
+        virtual void visitVariableDecl(VariableDeclStatement *node);
 
-        virtual void visitStruct(ionshared::Ptr<Struct> node);
-    };
+        virtual void visitScopeAnchor(ionshared::Scoped<Construct> *node);
+
+        virtual void visitIntegerType(IntegerType *node);
+
+        virtual void visitGlobal(Global *node);
+
+        virtual void visitErrorMarker(ErrorMarker *node);
 
-    typedef ionshared::BasePassManager<Pass, Construct> PassManager;
+        virtual void visitAttribute(Attribute *node);
+
+        virtual void visitStruct(Struct *node);
+
+    private:
+        /**
+         * Guards diagnostic builders while a diagnostic is being built.
+         */
+        static inline std::mutex diagnosticMutex;
+
+        struct TraversalFrame {
+            Construct *node;
+
+            bool childrenQueued;
+        };
+
+        /**
+         * Work stack used by traverse(). Kept as a member so that its
+         * capacity is reused between traversals.
+         */
+        std::vector<TraversalFrame> traversalStack;
+    };
 }
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <ionlang/misc/helpers.h>
+#include <ionlang/misc/profiler.h>
+#include <ionlang/misc/work_stealing_pool.h>
+#include <ionlang/passes/fused_pass.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Runs registered passes over an AST, in registration order.
+     * Consecutive function-scoped passes form a stage, which is run
+     * across all functions in parallel on a work-stealing pool. Each
+     * function goes through the whole stage on a single worker, using
+     * that worker's own clones of the stage's passes. Module-scoped
+     * passes act as barriers between stages. Optionally, consecutive
+     * fusible passes share a single traversal (see FusedPass).
+     */
+    class PassManager {
+    private:
+        std::vector<ionshared::Ptr<Pass>> passes;
+
+        size_t workerCount;
+
+        bool fusePasses;
+
+        ionshared::Ptr<AnalysisManager> analysisManager;
+
+        std::unique_ptr<WorkStealingPool> pool;
+
+        [[nodiscard]] WorkStealingPool &requirePool();
+
+        /**
+         * The passes to run, in order. If fusion is enabled, consecutive
+         * passes which may be fused (see FusedPass::canFuse()) are
+         * combined into fused passes.
+         */
+        [[nodiscard]] std::vector<ionshared::Ptr<Pass>> createPipeline() const;
+
+        void runFunctionStage(
+            const std::vector<ionshared::Ptr<Pass>> &stage,
+            const std::vector<ionshared::Ptr<Function>> &functions
+        );
+
+    public:
+        /**
+         * Collect the functions of the given AST, including those
+         * declared within its modules. Module functions follow the
+         * iteration order of the module's symbol table.
+         */
+        [[nodiscard]] static std::vector<ionshared::Ptr<Function>> collectFunctions(const Ast &ast);
+
+        /**
+         * A worker count of zero uses the hardware concurrency, while a
+         * count of one runs everything on the calling thread.
+         */
+        explicit PassManager(size_t workerCount = 0);
+
+        [[nodiscard]] const std::vector<ionshared::Ptr<Pass>> &getPasses() const noexcept;
+
+        [[nodiscard]] ionshared::Ptr<AnalysisManager> getAnalysisManager() const noexcept;
+
+        [[nodiscard]] bool isFusionEnabled() const noexcept;
+
+        /**
+         * Run consecutive fusible passes within a single traversal rather
+         * than walking the tree once per pass. Disabled by default.
+         */
+        void setFusionEnabled(bool fusePasses) noexcept;
+
+        /**
+         * Register a pass to be run. Unless the pass was given its own
+         * analysis manager, it will use the one of this pass manager.
+         */
+        void registerPass(ionshared::Ptr<Pass> pass);
+
+        /**
+         * Run the registered passes over the AST. The analysis manager's
+         * cached results are dropped once done.
+         */
+        void run(const Ast &ast);
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Replaces nodes bottom-up. Once a node's children have been visited
+     * (and possibly replaced), the node itself is offered for rewriting.
+     * Replacements are installed through Construct::replaceChild() once
+     * the parent's children are done, thus rewrites always see their
+     * children already rewritten. The root itself is never replaced.
+     * Derived passes overriding visitNode() or afterVisitChildren() must
+     * invoke the base methods.
+     */
+    class RewritePass : public Pass {
+    private:
+        struct PendingReplacement {
+            Construct *node;
+
+            ionshared::Ptr<Construct> replacement;
+        };
+
+        /**
+         * Replacements of nodes whose parent is still open, innermost last.
+         */
+        std::vector<PendingReplacement> pendingReplacements;
+
+        /**
+         * The amount of pending replacements upon entering each of the
+         * open nodes.
+         */
+        std::vector<size_t> marks;
+
+        uint64_t replacementCount;
+
+    protected:
+        /**
+         * Yield the node's replacement, or nullptr to keep the node.
+         */
+        [[nodiscard]] virtual ionshared::Ptr<Construct> rewrite(Construct *node) = 0;
+
+    public:
+        explicit RewritePass(
+            ionshared::Ptr<ionshared::PassContext> context,
+            PassScope passScope = PassScope::Module
+        );
+
+        void resetTraversalState() override;
+
+        void mergeStatistics(const Pass &clone) override;
+
+        void visitNode(Construct *node) override;
+
+        void afterVisitChildren(Construct *node) override;
+
+        /**
+         * The amount of nodes replaced so far.
+         */
+        [[nodiscard]] uint64_t getReplacementCount() const noexcept;
+    };
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <ionlang/analysis/constant_evaluator.h>
+#include <ionlang/passes/rewrite_pass.h>
+
+namespace ionlang {
+    /**
+     * Simplifies integer operations with a literal operand. Identities
+     * (ex. x + 0, x * 1, x * 0 or double negation) are removed, while
+     * multiplications by powers of two become shifts, as do unsigned
+     * divisions, with unsigned remainders becoming masks. Signed divisions
+     * and remainders are kept, as shifts would round towards negative
+     * infinity. Literals are moved to the right side of commutative
+     * operations, and chained additions or multiplications by literals
+     * are reassociated so that their literals are combined. Operands are
+     * only discarded if they contain no calls.
+     */
+    class AlgebraicSimplificationPass : public RewritePass {
+    private:
+        /**
+         * Retrieve the value of the literal, provided that it is
+         * an integer of the given type.
+         */
+        [[nodiscard]] static std::optional<int64_t> findInteger(Construct *construct, const IntegerType &type);
+
+        /**
+         * The power of two the value is, if any. Only positive values
+         * are considered for signed types.
+         */
+        [[nodiscard]] static std::optional<uint32_t> findPowerOfTwo(int64_t value, const IntegerType &type);
+
+        [[nodiscard]] static ionshared::Ptr<Construct> simplifyUnary(UnaryOperation *unaryOperation);
+
+        [[nodiscard]] static ionshared::Ptr<Construct> simplifyBinary(BinaryOperation *binaryOperation);
+
+    protected:
+        /**
+         * Apply the simplifications repeatedly, until none applies.
+         */
+        [[nodiscard]] ionshared::Ptr<Construct> rewrite(Construct *node) override;
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit AlgebraicSimplificationPass(
+            ionshared::Ptr<ionshared::PassContext> context
+        );
+
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        [[nodiscard]] bool isFusible() const override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+    };
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <ionlang/analysis/effect_analysis.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Eliminates repeated unary and binary operations within a block.
+     * Expressions are hashed structurally, and once an expression is
+     * found again while the locals it reads remain unassigned, its first
+     * occurrence is moved into a new local (the temporary) which both
+     * occurrences then refer to. Assignments (including those within
+     * nested blocks) make previous occurrences reading the assigned
+     * local unavailable. Blocks are processed independently of each
+     * other. Calls are only eliminated if the callee is pure, which is
+     * known once the module is visited; otherwise, expressions involving
+     * calls are left intact.
+     */
+    class CommonSubexpressionEliminationPass : public Pass {
+    private:
+        typedef std::unordered_set<const VariableDeclStatement *> Reads;
+
+        struct Occurrence {
+            /**
+             * The construct holding the expression as a direct child.
+             */
+            Construct *owner;
+
+            ionshared::Ptr<Construct> expression;
+
+            /**
+             * The block's statement which evaluates the expression.
+             * The temporary is inserted right before it.
+             */
+            Statement *anchor;
+
+            /**
+             * The occurrence whose expression directly contains this
+             * one, if any.
+             */
+            std::optional<size_t> enclosingIndex;
+
+            /**
+             * The locals read by the expression.
+             */
+            Reads reads;
+
+            ionshared::OptPtr<VariableDeclStatement> temporary;
+
+            bool isAvailable;
+        };
+
+        struct OccurrenceTable {
+            std::vector<Occurrence> occurrences;
+
+            /**
+             * The indices of the occurrences with the same hash.
+             */
+            std::unordered_multimap<size_t, size_t> buckets;
+        };
+
+        uint64_t eliminatedExpressionCount;
+
+        uint64_t temporaryCount;
+
+        /**
+         * The effects of the functions of the module being visited, if any.
+         */
+        std::shared_ptr<const EffectSummary> effectSummary;
+
+        [[nodiscard]] bool isPureCall(CallExpr *callExpr) const;
+
+        [[nodiscard]] bool isCandidate(Construct *value) const;
+
+        /**
+         * Hash the expression tree, collecting the locals it reads.
+         * Returns std::nullopt if the expression cannot be eliminated
+         * (ex. it contains an impure call or an unresolved reference).
+         */
+        [[nodiscard]] std::optional<size_t> hashExpression(Construct *value, Reads &reads) const;
+
+        /**
+         * Whether both expression trees are structurally the same,
+         * reading the same locals.
+         */
+        [[nodiscard]] static bool isEqual(Construct *first, Construct *second);
+
+        /**
+         * Make the occurrence unavailable along with those enclosing it,
+         * as their expressions are about to change.
+         */
+        static void invalidate(OccurrenceTable &table, std::optional<size_t> index);
+
+        /**
+         * Collect the locals assigned within the construct. Returns false
+         * if any of the assignments is unresolved.
+         */
+        static bool collectAssignments(Construct *construct, Reads &assignments);
+
+        /**
+         * Make all occurrences reading any of the locals unavailable, or
+         * all occurrences altogether if the locals are unknown.
+         */
+        static void kill(OccurrenceTable &table, const std::optional<Reads> &assignments);
+
+        [[nodiscard]] ionshared::Ptr<VariableRefExpr> createTemporaryRef(
+            Block *block,
+            const ionshared::Ptr<VariableDeclStatement> &temporary
+        ) const;
+
+        /**
+         * Move the occurrence's expression into a new temporary declared
+         * right before its anchor, leaving a reference to the temporary
+         * in its place. Returns std::nullopt if the expression has no type.
+         */
+        ionshared::OptPtr<VariableDeclStatement> materialize(
+            Block *block,
+            OccurrenceTable &table,
+            size_t index
+        );
+
+        /**
+         * Walk the owner's child expression top-down, replacing expressions
+         * which were already evaluated, and recording the rest.
+         */
+        void eliminate(
+            Block *block,
+            OccurrenceTable &table,
+            Construct *owner,
+            const ionshared::Ptr<Construct> &value,
+            Statement *anchor,
+            std::optional<size_t> enclosingIndex
+        );
+
+        void eliminateBlock(Block *block);
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit CommonSubexpressionEliminationPass(
+            ionshared::Ptr<ionshared::PassContext> context
+        );
+
+        [[nodiscard]] bool isFusible() const override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        void visitModule(Module *node) override;
+
+        void afterVisitChildren(Construct *node) override;
+
+        /**
+         * The amount of expressions replaced by a reference to a
+         * temporary so far.
+         */
+        [[nodiscard]] uint64_t getEliminatedExpressionCount() const noexcept;
+    };
+}
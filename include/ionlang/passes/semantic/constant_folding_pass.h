@@ -0,0 +1,34 @@
+#pragma once
+
+#include <ionshared/diagnostics/diagnostic.h>
+#include <ionlang/analysis/constant_evaluator.h>
+#include <ionlang/diagnostics/diagnostic.h>
+#include <ionlang/passes/rewrite_pass.h>
+
+namespace ionlang {
+    /**
+     * Replaces unary and binary operations on integer and boolean
+     * literals with the literal they evaluate to, so that no instructions
+     * are emitted for them. Nested operations are folded bottom-up.
+     * Overflowing operations are folded into their wrapped result and
+     * reported as a warning, while divisions by zero are reported as
+     * an error and left in place.
+     */
+    class ConstantFoldingPass : public RewritePass {
+    protected:
+        [[nodiscard]] ionshared::Ptr<Construct> rewrite(Construct *node) override;
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit ConstantFoldingPass(
+            ionshared::Ptr<ionshared::PassContext> context
+        );
+
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        [[nodiscard]] bool isFusible() const override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+    };
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <unordered_map>
+#include <ionlang/analysis/constant_evaluator.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Propagates the constant values of local variables through their
+     * uses, following the function's control flow. References to locals
+     * holding a known constant are replaced by the constant, and if
+     * statements whose condition becomes constant are replaced by the
+     * taken branch (or removed altogether). Branches which are pruned
+     * never contribute to the values seen afterwards. Operations which
+     * may overflow or divide by zero are left to ConstantFoldingPass,
+     * which reports them.
+     */
+    class ConstantPropagationPass : public Pass {
+    private:
+        /**
+         * The constant value of each local known to hold one at the
+         * current point. Locals absent from the map hold unknown values.
+         */
+        typedef std::unordered_map<VariableDeclStatement *, Constant> Environment;
+
+        uint64_t substitutionCount;
+
+        uint64_t prunedBranchCount;
+
+        /**
+         * Keep only the values which are the same on both environments.
+         */
+        [[nodiscard]] static Environment merge(const Environment &first, const Environment &second);
+
+        /**
+         * Substitute known locals within the value, then fold it if it
+         * became constant. Returns the value's replacement, or nullptr
+         * if the value was kept.
+         */
+        [[nodiscard]] ionshared::Ptr<Construct> substitute(
+            Construct *value,
+            const Environment &environment
+        );
+
+        /**
+         * Substitute the owner's child in place, then retrieve the
+         * constant it holds, if any.
+         */
+        std::optional<Constant> propagateInto(
+            Construct *owner,
+            Construct *child,
+            const Environment &environment
+        );
+
+        /**
+         * Returns false if the end of the block is unreachable (ex. every
+         * path returns beforehand).
+         */
+        bool propagateBlock(Block *block, Environment &environment);
+
+        /**
+         * Propagate through the if statement at the given position, which
+         * is replaced by its taken branch if its condition is constant.
+         */
+        bool propagateIfStatement(
+            Block *block,
+            size_t orderIndex,
+            Environment &environment
+        );
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit ConstantPropagationPass(
+            ionshared::Ptr<ionshared::PassContext> context
+        );
+
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        void mergeStatistics(const Pass &clone) override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        void visitFunction(Function *node) override;
+
+        /**
+         * Functions are propagated through at once, when visited.
+         */
+        [[nodiscard]] bool shouldVisitChildren(Construct *node) override;
+
+        /**
+         * The amount of variable references replaced by constants so far.
+         */
+        [[nodiscard]] uint64_t getSubstitutionCount() const noexcept;
+
+        /**
+         * The amount of if statements replaced by one of their branches,
+         * or removed, so far.
+         */
+        [[nodiscard]] uint64_t getPrunedBranchCount() const noexcept;
+    };
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <ionlang/analysis/call_graph.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Replaces calls to small functions with a copy of the function's
+     * body. Locals of the copy are renamed, so that they never collide
+     * with the caller's own, and arguments are bound to new locals ahead
+     * of the copy, preserving their evaluation order. Functions are
+     * processed bottom-up over the call graph, so callees are simplified
+     * before they are copied. Calls are inlined if they form the whole
+     * value of their statement (ex. 'let x = f();'), the callee returns
+     * from its last statement only, and the callee is small enough or
+     * is annotated with the inline attribute. Recursive functions and
+     * functions annotated with the noinline attribute are never inlined.
+     */
+    class InliningPass : public Pass {
+    private:
+        uint32_t sizeThreshold;
+
+        uint64_t inlinedCallCount;
+
+        uint32_t nameCounter;
+
+        /**
+         * The amount of constructs within the function's body.
+         */
+        [[nodiscard]] static size_t estimateSize(Function *function);
+
+        /**
+         * Whether the function returns from its last statement only,
+         * and has no unresolved references besides its parameters.
+         */
+        [[nodiscard]] static bool isInlinable(Function *function);
+
+        /**
+         * The call forming the whole value of the statement, if any.
+         */
+        [[nodiscard]] static CallExpr *findTopLevelCall(Statement *statement);
+
+        [[nodiscard]] Function *findInlinableCallee(
+            CallExpr *callExpr,
+            Function *caller,
+            const CallGraph &callGraph
+        ) const;
+
+        /**
+         * Inline the call within the statement at the given position.
+         * Returns the position following the statements the call was
+         * replaced by, or std::nullopt if the call was left in place.
+         */
+        std::optional<size_t> inlineCall(
+            Block *block,
+            size_t orderIndex,
+            CallExpr *callExpr,
+            Function *callee
+        );
+
+        void inlineBlock(Block *block, Function *caller, const CallGraph &callGraph);
+
+    public:
+        IONSHARED_PASS_ID;
+
+        static constexpr std::string_view inlineAttributeName = "inline";
+
+        static constexpr std::string_view noInlineAttributeName = "noinline";
+
+        static constexpr uint32_t defaultSizeThreshold = 40;
+
+        explicit InliningPass(
+            ionshared::Ptr<ionshared::PassContext> context,
+            uint32_t sizeThreshold = InliningPass::defaultSizeThreshold
+        );
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        void visitModule(Module *node) override;
+
+        /**
+         * Modules are inlined at once, when visited.
+         */
+        [[nodiscard]] bool shouldVisitChildren(Construct *node) override;
+
+        [[nodiscard]] uint64_t getInlinedCallCount() const noexcept;
+    };
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <unordered_map>
+#include <ionlang/analysis/range_analysis.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Acts on the integer ranges of each function. Comparisons whose
+     * outcome is decided by the ranges of their operands are replaced
+     * by the boolean they yield. Then, 64-bit locals along with the
+     * operations and literals they are computed from are narrowed to
+     * the smallest integer type holding all their values. Values which
+     * flow to or from elsewhere (ex. call arguments or return values)
+     * keep their type, and so does everything connected to them, as
+     * no implicit conversions are performed.
+     */
+    class IntegerNarrowingPass : public Pass {
+    private:
+        /**
+         * Disjoint sets of constructs which must share the same type,
+         * each represented by one of its members.
+         */
+        struct Webs {
+            std::unordered_map<Construct *, Construct *> representatives;
+
+            Construct *find(Construct *construct);
+
+            void join(Construct *first, Construct *second);
+        };
+
+        uint64_t foldedComparisonCount;
+
+        uint64_t narrowedVariableCount;
+
+        /**
+         * Whether the construct is a 64-bit local, or an integer literal
+         * or arithmetic operation of such type (or a reference to such
+         * local), which may be narrowed.
+         */
+        [[nodiscard]] static bool isNarrowable(Construct *construct);
+
+        /**
+         * Copy the narrowable value with the given type. References
+         * are kept as they are.
+         */
+        [[nodiscard]] static ionshared::Ptr<Construct> retype(
+            Construct *value,
+            const ionshared::Ptr<IntegerType> &type
+        );
+
+        void foldComparisons(Function *function, const IntegerRanges &integerRanges);
+
+        void narrowVariables(Function *function, const IntegerRanges &integerRanges);
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit IntegerNarrowingPass(
+            ionshared::Ptr<ionshared::PassContext> context
+        );
+
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        void mergeStatistics(const Pass &clone) override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        void visitFunction(Function *node) override;
+
+        /**
+         * Functions are processed at once, when visited.
+         */
+        [[nodiscard]] bool shouldVisitChildren(Construct *node) override;
+
+        /**
+         * The amount of comparisons replaced by a boolean so far.
+         */
+        [[nodiscard]] uint64_t getFoldedComparisonCount() const noexcept;
+
+        /**
+         * The amount of locals whose type was narrowed so far.
+         */
+        [[nodiscard]] uint64_t getNarrowedVariableCount() const noexcept;
+    };
+}
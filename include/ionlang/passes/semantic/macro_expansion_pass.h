@@ -13,5 +13,9 @@ namespace ionlang {
         explicit MacroExpansionPass(
             ionshared::Ptr<ionshared::PassContext> context
         );
+
+        [[nodiscard]] bool isFusible() const override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
     };
 }
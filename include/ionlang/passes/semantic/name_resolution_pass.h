@@ -1,7 +1,13 @@
 #pragma once
 
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include <ionshared/diagnostics/diagnostic.h>
 #include <ionshared/tracking/symbol_table.h>
+#include <ionlang/analysis/block_analysis.h>
+#include <ionlang/diagnostics/diagnostic.h>
 #include <ionlang/misc/helpers.h>
 #include <ionlang/passes/pass.h>
 
@@ -11,22 +17,114 @@ namespace ionlang {
      * undefined symbols at the time by their identifier(s).
      */
     class NameResolutionPass : public Pass {
+    public:
+        /**
+         * A reference which could not be resolved. Recorded by value, as
+         * the reference itself may be freed along with its tree.
+         */
+        struct UndefinedRef {
+            std::string name;
+
+            RefKind refKind;
+
+            std::optional<ionshared::SourceLocation> sourceLocation;
+        };
+
     private:
-        std::list<ionshared::PtrSymbolTable<Construct>> scope;
+        typedef std::vector<VariableDeclStatement *> BindingStack;
+
+        std::list<PtrFlatSymbolTable<Construct>> scope;
+
+        /**
+         * The variable declarations currently in scope, by name. The
+         * innermost declaration of each name is at the back of its stack.
+         */
+        std::unordered_map<std::string, BindingStack> bindings;
+
+        /**
+         * Binding stacks pushed onto, in order. Pointers to the values of
+         * an unordered map remain valid as it grows.
+         */
+        std::vector<BindingStack *> undoLog;
+
+        /**
+         * The undo log size upon entering each of the open blocks.
+         */
+        std::vector<size_t> scopeMarks;
+
+        std::vector<UndefinedRef> undefinedRefs;
+
+        /**
+         * The module last visited, if its worklist of pending references
+         * was drained upon being visited. Its children are not walked.
+         */
+        Module *drainedModule;
+
+        void pushScope();
+
+        void popScope();
+
+        void bind(VariableDeclStatement *variableDecl);
+
+        [[nodiscard]] VariableDeclStatement *findBinding(const std::string &name) const;
+
+        /**
+         * Record an undefined reference and report it. Resolution carries
+         * on, so that all undefined references are reported at once.
+         */
+        void reportUndefinedRef(Ref<> *ref);
+
+        /**
+         * Resolve the references on the module's worklist, then discard
+         * the worklist. Function references are looked up directly, while
+         * only the functions holding pending variable references are
+         * walked, so that declaration order is respected.
+         */
+        void resolvePendingRefs(Module *module);
 
     public:
         IONSHARED_PASS_ID;
 
+        /**
+         * Function-scoped instances resolve each function on its own
+         * (possibly in parallel), by walking it. Module worklists of
+         * pending references are then left to module-scoped instances.
+         */
         explicit NameResolutionPass(
-            ionshared::Ptr<ionshared::PassContext> context
+            ionshared::Ptr<ionshared::PassContext> context,
+            PassScope passScope = PassScope::Module
         );
 
-        void visitModule(ionshared::Ptr<Module> node) override;
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        [[nodiscard]] bool isFusible() const override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        /**
+         * Discard the scopes, bindings and undefined references of the
+         * previous traversal, which may have been left behind if it threw.
+         */
+        void resetTraversalState() override;
+
+        void visitModule(Module *node) override;
+
+        void visitBlock(Block *node) override;
+
+        [[nodiscard]] bool shouldVisitChildren(Construct *node) override;
+
+        void afterVisitChildren(Construct *node) override;
+
+        void visitScopeAnchor(ionshared::Scoped<Construct> *node) override;
 
-        void visitScopeAnchor(ionshared::Ptr<ionshared::Scoped<Construct>> node) override;
+        void visitRef(Ref<> *node) override;
 
-        void visitRef(PtrRef<> node) override;
+        [[nodiscard]] const std::list<PtrFlatSymbolTable<Construct>> &getScope() const;
 
-        [[nodiscard]] const std::list<ionshared::PtrSymbolTable<Construct>> &getScope() const;
+        /**
+         * The references which could not be resolved during the last
+         * traversal.
+         */
+        [[nodiscard]] const std::vector<UndefinedRef> &getUndefinedRefs() const noexcept;
     };
 }
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <ionshared/diagnostics/diagnostic.h>
+#include <ionlang/diagnostics/diagnostic.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Removes statements which can never be reached, as they follow a
+     * terminal statement (or an if statement whose branches all end in
+     * one), and reports them as a warning. Empty branches of if
+     * statements are removed as well, along with if statements left
+     * with no branches at all.
+     */
+    class UnreachableCodeEliminationPass : public Pass {
+    private:
+        uint64_t removedStatementCount;
+
+        /**
+         * Whether the end of the block is unreachable. Blocks are processed
+         * after their children, so a diverging block already ends with its
+         * diverging statement.
+         */
+        [[nodiscard]] static bool isDiverging(Block *block);
+
+        /**
+         * Whether control never flows past the statement.
+         */
+        [[nodiscard]] static bool isDiverging(Statement *statement);
+
+        void removeUnreachableStatements(Block *block);
+
+        void removeEmptyBranches(Block *block);
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit UnreachableCodeEliminationPass(
+            ionshared::Ptr<ionshared::PassContext> context
+        );
+
+        [[nodiscard]] ionshared::Ptr<Pass> clone() const override;
+
+        void mergeStatistics(const Pass &clone) override;
+
+        [[nodiscard]] bool isFusible() const override;
+
+        [[nodiscard]] std::string_view getPassName() const override;
+
+        void afterVisitChildren(Construct *node) override;
+
+        /**
+         * The amount of statements removed so far, including if
+         * statements left without branches.
+         */
+        [[nodiscard]] uint64_t getRemovedStatementCount() const noexcept;
+    };
+}
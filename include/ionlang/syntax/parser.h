@@ -10,6 +10,7 @@
 #include <ionlang/diagnostics/diagnostic.h>
 #include <ionlang/passes/pass.h>
 #include <ionlang/misc/util.h>
+#include <ionlang/type_system/type_context.h>
 
 #define IONLANG_PARSER_ASSERT(condition) if (!condition) { return this->makeErrorMarker(); }
 
@@ -26,6 +27,14 @@ namespace ionlang {
 
         ionshared::Ptr<ionshared::SourceMap<ionshared::Ptr<Construct>>> sourceMap;
 
+        ionshared::Ptr<TypeContext> typeContext;
+
+        /**
+         * References created while parsing the current module, to be
+         * attached to it as its pending references worklist.
+         */
+        Ast pendingRefs;
+
         /**
          * A stack of source location mapping beginnings, containing a
          * pair with the first item denoting the line number and the second
@@ -56,6 +65,23 @@ namespace ionlang {
 
         void finishSourceLocationMapping(const ionshared::Ptr<Construct> &construct);
 
+        /**
+         * Create a reference and register it on the pending references
+         * worklist, to be resolved once the whole module is parsed.
+         */
+        template<typename T = Construct>
+        ionshared::Ptr<Ref<T>> makeRef(
+            const std::string &id,
+            const ionshared::Ptr<Construct> &owner,
+            RefKind kind
+        ) {
+            ionshared::Ptr<Ref<T>> ref = std::make_shared<Ref<T>>(id, owner, kind);
+
+            this->pendingRefs.push_back(ref);
+
+            return ref;
+        }
+
         template<typename T = Construct>
         AstPtrResult<T> sourceMapCallback(const std::function<AstPtrResult<>()> &callback) {
             this->beginSourceLocationMapping();
@@ -78,7 +104,9 @@ namespace ionlang {
             TokenStream stream,
 
             ionshared::Ptr<ionshared::DiagnosticBuilder> diagnosticBuilder =
-                ionshared::Ptr<ionshared::DiagnosticBuilder>()
+                ionshared::Ptr<ionshared::DiagnosticBuilder>(),
+
+            ionshared::Ptr<TypeContext> typeContext = TypeContext::getDefault()
         );
 
         [[nodiscard]] ionshared::Ptr<ionshared::DiagnosticBuilder> getDiagnosticBuilder() const;
@@ -169,7 +197,7 @@ namespace ionlang {
             IONLANG_PARSER_ASSERT(id.has_value())
 
             // TODO: Parsing variable ref. only! Not taking in what kind in params!
-            return std::make_shared<Ref<T>>(*id, owner, RefKind::Variable);
+            return this->makeRef<T>(*id, owner, RefKind::Variable);
         }
     };
 }
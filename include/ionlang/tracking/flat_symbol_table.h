@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <ionshared/misc/helpers.h>
+
+namespace ionlang {
+    /**
+     * A symbol table backed by an open-addressing (linear probing) hash
+     * index over a vector of entries. Entries are kept in insertion order,
+     * so iteration is deterministic. Lookups accept string views, and
+     * neither they nor iteration allocate.
+     */
+    template<typename T>
+    class FlatSymbolTable {
+    private:
+        struct Entry {
+            std::string key;
+
+            size_t hash;
+
+            T value;
+
+            bool isErased;
+        };
+
+        static constexpr uint32_t emptySlot = std::numeric_limits<uint32_t>::max();
+
+        static constexpr size_t minimumSlotCount = 8;
+
+        std::vector<Entry> entries;
+
+        /**
+         * Indices into the entries vector. The amount of slots is always
+         * a power of two, so that probing may wrap around using a mask.
+         */
+        std::vector<uint32_t> slots;
+
+        size_t size;
+
+        [[nodiscard]] static size_t hashKey(std::string_view key) noexcept {
+            return std::hash<std::string_view>{}(key);
+        }
+
+        /**
+         * Find the slot referring to the entry with the given key, or
+         * otherwise the empty slot where such entry would be placed.
+         * There must be at least one slot.
+         */
+        [[nodiscard]] size_t findSlot(std::string_view key, size_t hash) const noexcept {
+            size_t mask = this->slots.size() - 1;
+
+            for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+                uint32_t index = this->slots[slot];
+
+                if (index == FlatSymbolTable::emptySlot) {
+                    return slot;
+                }
+
+                const Entry &entry = this->entries[index];
+
+                if (entry.hash == hash && entry.key == key) {
+                    return slot;
+                }
+            }
+        }
+
+        [[nodiscard]] const Entry *findEntry(std::string_view key) const noexcept {
+            if (this->slots.empty()) {
+                return nullptr;
+            }
+
+            uint32_t index = this->slots[this->findSlot(key, FlatSymbolTable::hashKey(key))];
+
+            if (index == FlatSymbolTable::emptySlot || this->entries[index].isErased) {
+                return nullptr;
+            }
+
+            return &this->entries[index];
+        }
+
+        /**
+         * Drop erased entries and rebuild the index with the given amount
+         * of slots. Insertion order is preserved.
+         */
+        void rehash(size_t slotCount) {
+            std::vector<Entry> liveEntries = {};
+
+            liveEntries.reserve(this->size);
+
+            for (auto &entry : this->entries) {
+                if (!entry.isErased) {
+                    liveEntries.push_back(std::move(entry));
+                }
+            }
+
+            this->entries = std::move(liveEntries);
+            this->slots.assign(slotCount, FlatSymbolTable::emptySlot);
+
+            for (size_t index = 0; index < this->entries.size(); index++) {
+                const Entry &entry = this->entries[index];
+
+                this->slots[this->findSlot(entry.key, entry.hash)] = static_cast<uint32_t>(index);
+            }
+        }
+
+        /**
+         * Ensure there is room for one more entry, keeping the load factor
+         * (counting erased entries still referenced by the index) at or
+         * below 3/4.
+         */
+        void reserveOne() {
+            if ((this->entries.size() + 1) * 4 <= this->slots.size() * 3) {
+                return;
+            }
+
+            size_t slotCount = std::max(this->slots.size(), FlatSymbolTable::minimumSlotCount);
+
+            while ((this->size + 1) * 4 > slotCount * 3) {
+                slotCount *= 2;
+            }
+
+            this->rehash(slotCount);
+        }
+
+    public:
+        FlatSymbolTable() :
+            entries(),
+            slots(),
+            size(0) {
+            //
+        }
+
+        /**
+         * Set the value of the given key. Returns true if the key was
+         * not previously present. Overwriting an existing key retains its
+         * position in the iteration order.
+         */
+        bool set(std::string key, T value) {
+            this->reserveOne();
+
+            size_t hash = FlatSymbolTable::hashKey(key);
+            size_t slot = this->findSlot(key, hash);
+            uint32_t index = this->slots[slot];
+
+            if (index != FlatSymbolTable::emptySlot && !this->entries[index].isErased) {
+                this->entries[index].value = std::move(value);
+
+                return false;
+            }
+
+            /**
+             * The key is either new, or was erased. In the latter case
+             * the slot is re-pointed to a new entry, which places the
+             * key at the end of the iteration order.
+             */
+            this->slots[slot] = static_cast<uint32_t>(this->entries.size());
+
+            this->entries.push_back(Entry{
+                std::move(key),
+                hash,
+                std::move(value),
+                false
+            });
+
+            this->size++;
+
+            return true;
+        }
+
+        [[nodiscard]] bool contains(std::string_view key) const noexcept {
+            return this->findEntry(key) != nullptr;
+        }
+
+        [[nodiscard]] std::optional<T> lookup(std::string_view key) const {
+            const Entry *entry = this->findEntry(key);
+
+            if (entry == nullptr) {
+                return std::nullopt;
+            }
+
+            return entry->value;
+        }
+
+        /**
+         * Retrieve a pointer to the value of the given key without copying
+         * it, or nullptr if not present. The pointer is invalidated upon
+         * the next modification of the table.
+         */
+        [[nodiscard]] const T *find(std::string_view key) const noexcept {
+            const Entry *entry = this->findEntry(key);
+
+            return entry != nullptr ? &entry->value : nullptr;
+        }
+
+        bool remove(std::string_view key) {
+            if (this->slots.empty()) {
+                return false;
+            }
+
+            uint32_t index = this->slots[this->findSlot(key, FlatSymbolTable::hashKey(key))];
+
+            if (index == FlatSymbolTable::emptySlot || this->entries[index].isErased) {
+                return false;
+            }
+
+            /**
+             * The entry is kept as a tombstone so that probe chains passing
+             * through its slot remain intact. Its value is released right
+             * away, and tombstones are dropped on the next rehash.
+             */
+            this->entries[index].isErased = true;
+            this->entries[index].value = T();
+            this->size--;
+
+            if (this->size * 2 < this->entries.size()) {
+                this->rehash(this->slots.size());
+            }
+
+            return true;
+        }
+
+        void clear() noexcept {
+            this->entries.clear();
+            this->slots.clear();
+            this->size = 0;
+        }
+
+        void reserve(size_t capacity) {
+            size_t slotCount = FlatSymbolTable::minimumSlotCount;
+
+            while (capacity * 4 > slotCount * 3) {
+                slotCount *= 2;
+            }
+
+            this->entries.reserve(capacity);
+
+            if (slotCount > this->slots.size()) {
+                this->rehash(slotCount);
+            }
+        }
+
+        [[nodiscard]] size_t getSize() const noexcept {
+            return this->size;
+        }
+
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return this->size == 0;
+        }
+
+        /**
+         * The amount of heap memory held by the table's own storage. Memory
+         * held by the keys and values (ex. the constructs pointed to) is
+         * not included.
+         */
+        [[nodiscard]] size_t getHeapBytes() const noexcept {
+            return this->entries.capacity() * sizeof(Entry)
+                + this->slots.capacity() * sizeof(uint32_t);
+        }
+
+        /**
+         * Invoke the callback with the key and value of each entry, in
+         * insertion order. The table must not be modified meanwhile.
+         */
+        template<typename TCallback>
+        void forEach(TCallback callback) const {
+            for (const auto &entry : this->entries) {
+                if (!entry.isErased) {
+                    callback(entry.key, entry.value);
+                }
+            }
+        }
+    };
+
+    template<typename T>
+    using PtrFlatSymbolTable = ionshared::Ptr<FlatSymbolTable<ionshared::Ptr<T>>>;
+}
+
+namespace ionlang::util {
+    template<typename T>
+    [[nodiscard]] PtrFlatSymbolTable<T> makePtrFlatSymbolTable() {
+        return std::make_shared<FlatSymbolTable<ionshared::Ptr<T>>>();
+    }
+}
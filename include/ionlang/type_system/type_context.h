@@ -0,0 +1,105 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <ionlang/construct/type/integer_type.h>
+#include <ionlang/construct/type/boolean_type.h>
+#include <ionlang/construct/type/void_type.h>
+
+namespace ionlang {
+    /**
+     * Interns built-in types, handing out a single canonical instance
+     * per kind, bit-width, signedness and qualifier set. Two types
+     * obtained from the same context are equal if and only if they are
+     * the same instance. Canonical types are shared across the AST, and
+     * must therefore never be mutated.
+     */
+    class TypeContext {
+    private:
+        struct TypeKey {
+            TypeKind kind;
+
+            uint32_t bitWidth;
+
+            bool isSigned;
+
+            uint8_t qualifierMask;
+
+            [[nodiscard]] bool operator==(const TypeKey &other) const noexcept;
+        };
+
+        struct TypeKeyHash {
+            [[nodiscard]] size_t operator()(const TypeKey &key) const noexcept;
+        };
+
+        [[nodiscard]] static uint8_t makeQualifierMask(
+            const ionshared::Ptr<TypeQualifiers> &qualifiers
+        );
+
+        /**
+         * Copy the given qualifiers for a new canonical instance, so that
+         * it does not share a set which may later be modified.
+         */
+        [[nodiscard]] static ionshared::Ptr<TypeQualifiers> copyQualifiers(
+            const ionshared::Ptr<TypeQualifiers> &qualifiers
+        );
+
+        std::unordered_map<TypeKey, ionshared::Ptr<Type>, TypeKeyHash> types;
+
+        std::mutex mutex;
+
+        template<typename T>
+        [[nodiscard]] ionshared::Ptr<T> intern(
+            const TypeKey &key,
+            const std::function<ionshared::Ptr<T>()> &factory
+        ) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            auto existing = this->types.find(key);
+
+            if (existing != this->types.end()) {
+                return existing->second->template staticCast<T>();
+            }
+
+            ionshared::Ptr<T> type = factory();
+
+            type->isInterned = true;
+            this->types.emplace(key, type);
+
+            return type;
+        }
+
+    public:
+        /**
+         * The context used by the type factory, and by default by the
+         * parser.
+         */
+        [[nodiscard]] static ionshared::Ptr<TypeContext> getDefault();
+
+        TypeContext();
+
+        [[nodiscard]] ionshared::Ptr<IntegerType> getIntegerType(
+            IntegerKind integerKind,
+            bool isSigned = true,
+            const ionshared::Ptr<TypeQualifiers> &qualifiers = nullptr
+        );
+
+        [[nodiscard]] ionshared::Ptr<BooleanType> getBooleanType(
+            const ionshared::Ptr<TypeQualifiers> &qualifiers = nullptr
+        );
+
+        [[nodiscard]] ionshared::Ptr<VoidType> getVoidType();
+
+        /**
+         * Get the canonical variant of the given built-in type with the
+         * given qualifiers in place of its own. Interned types may not
+         * be qualified in place, as they are shared.
+         */
+        [[nodiscard]] ionshared::Ptr<Type> getQualifiedType(
+            const ionshared::Ptr<Type> &type,
+            const ionshared::Ptr<TypeQualifiers> &qualifiers
+        );
+
+        [[nodiscard]] size_t getSize();
+    };
+}
@@ -5,6 +5,10 @@
 #include <ionlang/construct/type/void_type.h>
 
 namespace ionlang::type_factory {
+    /**
+     * Types are interned on the default type context, so each call
+     * with the same arguments yields the same canonical instance.
+     */
     [[nodiscard]] ionshared::Ptr<IntegerType> typeInteger(
         IntegerKind integerKind,
         bool isSigned = true
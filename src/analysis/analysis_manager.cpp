@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <ionlang/analysis/analysis_manager.h>
+
+namespace ionlang {
+    AnalysisManager::AnalysisManager() :
+        mutex(),
+        entries(),
+        hitCount(0),
+        missCount(0),
+        pruneThreshold(AnalysisManager::minimumPruneThreshold) {
+        //
+    }
+
+    void AnalysisManager::pruneExpired() {
+        for (auto entry = this->entries.begin(); entry != this->entries.end();) {
+            entry = entry->second.owner.expired()
+                ? this->entries.erase(entry)
+                : std::next(entry);
+        }
+
+        this->pruneThreshold = std::max(AnalysisManager::minimumPruneThreshold, this->entries.size() * 2);
+    }
+
+    void AnalysisManager::invalidate(const Construct *construct) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        for (auto entry = this->entries.begin(); entry != this->entries.end();) {
+            entry = entry->first.construct == construct
+                ? this->entries.erase(entry)
+                : std::next(entry);
+        }
+    }
+
+    void AnalysisManager::prune() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        for (auto entry = this->entries.begin(); entry != this->entries.end();) {
+            ionshared::Ptr<Construct> owner = entry->second.owner.lock();
+
+            entry = owner == nullptr || entry->second.getCurrentStamp(owner.get()) != entry->second.stamp
+                ? this->entries.erase(entry)
+                : std::next(entry);
+        }
+
+        this->pruneThreshold = std::max(AnalysisManager::minimumPruneThreshold, this->entries.size() * 2);
+    }
+
+    void AnalysisManager::clear() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->entries.clear();
+    }
+
+    size_t AnalysisManager::getSize() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        return this->entries.size();
+    }
+
+    size_t AnalysisManager::getHitCount() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        return this->hitCount;
+    }
+
+    size_t AnalysisManager::getMissCount() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        return this->missCount;
+    }
+}
@@ -0,0 +1,27 @@
+#include <ionlang/analysis/block_analysis.h>
+
+namespace ionlang {
+    ParentFunctionAnalysis::Result ParentFunctionAnalysis::run(
+        Construct *construct,
+        AnalysisManager &analysisManager
+    ) {
+        ionshared::OptPtr<Function> function = construct->rawCast<Block>()->findParentFunction();
+
+        return function.has_value() ? function->get() : nullptr;
+    }
+
+    TerminalsAnalysis::Result TerminalsAnalysis::run(
+        Construct *construct,
+        AnalysisManager &analysisManager
+    ) {
+        Result terminals = {};
+
+        for (const auto &statement : construct->rawCast<Block>()->statements) {
+            if (statement->isTerminal()) {
+                terminals.push_back(statement.get());
+            }
+        }
+
+        return terminals;
+    }
+}
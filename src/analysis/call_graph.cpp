@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+#include <ionlang/passes/pass.h>
+#include <ionlang/analysis/call_graph.h>
+
+namespace ionlang {
+    std::vector<Construct *> CallGraph::resolveIndices(const std::vector<size_t> &indices) const {
+        std::vector<Construct *> result = {};
+
+        result.reserve(indices.size());
+
+        for (const size_t index : indices) {
+            result.push_back(this->nodes[index]);
+        }
+
+        return result;
+    }
+
+    void CallGraph::computeComponents() {
+        static constexpr size_t unvisited = std::numeric_limits<size_t>::max();
+
+        struct Frame {
+            size_t node;
+
+            size_t nextCalleeIndex;
+        };
+
+        size_t nodeCount = this->nodes.size();
+        size_t counter = 0;
+        std::vector<size_t> visitOrder = std::vector<size_t>(nodeCount, unvisited);
+        std::vector<size_t> lowLinks = std::vector<size_t>(nodeCount, 0);
+        std::vector<bool> onStack = std::vector<bool>(nodeCount, false);
+        std::vector<size_t> stack = {};
+        std::vector<Frame> frames = {};
+
+        this->components.clear();
+        this->componentIndices.assign(nodeCount, 0);
+
+        auto enter = [&](size_t node) {
+            visitOrder[node] = lowLinks[node] = counter++;
+            stack.push_back(node);
+            onStack[node] = true;
+            frames.push_back(Frame{node, 0});
+        };
+
+        for (size_t root = 0; root < nodeCount; root++) {
+            if (visitOrder[root] != unvisited) {
+                continue;
+            }
+
+            enter(root);
+
+            while (!frames.empty()) {
+                size_t node = frames.back().node;
+                const std::vector<size_t> &callees = this->calleeIndices[node];
+
+                if (frames.back().nextCalleeIndex < callees.size()) {
+                    size_t callee = callees[frames.back().nextCalleeIndex++];
+
+                    if (visitOrder[callee] == unvisited) {
+                        enter(callee);
+                    }
+                    else if (onStack[callee]) {
+                        lowLinks[node] = std::min(lowLinks[node], visitOrder[callee]);
+                    }
+
+                    continue;
+                }
+
+                frames.pop_back();
+
+                // The node is the root of a component, which is complete.
+                if (lowLinks[node] == visitOrder[node]) {
+                    std::vector<Construct *> component = {};
+                    size_t member;
+
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = false;
+                        this->componentIndices[member] = this->components.size();
+                        component.push_back(this->nodes[member]);
+                    }
+                    while (member != node);
+
+                    this->components.push_back(std::move(component));
+                }
+
+                if (!frames.empty()) {
+                    size_t caller = frames.back().node;
+
+                    lowLinks[caller] = std::min(lowLinks[caller], lowLinks[node]);
+                }
+            }
+        }
+    }
+
+    CallGraph CallGraph::build(Module *module) {
+        CallGraph callGraph = CallGraph();
+
+        module->symbolTable->forEach([&callGraph](const std::string &id, const ionshared::Ptr<Construct> &topLevelConstruct) {
+            if (topLevelConstruct->constructKind == ConstructKind::Function
+                || topLevelConstruct->constructKind == ConstructKind::Extern) {
+                callGraph.indices[topLevelConstruct.get()] = callGraph.nodes.size();
+                callGraph.nodes.push_back(topLevelConstruct.get());
+            }
+        });
+
+        size_t nodeCount = callGraph.nodes.size();
+
+        callGraph.calleeIndices.resize(nodeCount);
+        callGraph.callerIndices.resize(nodeCount);
+        callGraph.selfCalls.assign(nodeCount, false);
+
+        std::unordered_set<size_t> calleeSet = {};
+        std::vector<Construct *> stack = {};
+
+        for (size_t caller = 0; caller < nodeCount; caller++) {
+            Construct *node = callGraph.nodes[caller];
+
+            if (node->constructKind != ConstructKind::Function) {
+                continue;
+            }
+
+            calleeSet.clear();
+            stack.push_back(node->rawCast<Function>()->body.get());
+
+            while (!stack.empty()) {
+                Construct *construct = stack.back();
+
+                stack.pop_back();
+
+                if (construct->constructKind == ConstructKind::Ref) {
+                    auto ref = construct->rawCast<Ref<>>();
+
+                    if (ref->refKind != RefKind::Function || !ref->isResolved()) {
+                        continue;
+                    }
+
+                    auto calleeIndex = callGraph.indices.find(ref->value->get());
+
+                    if (calleeIndex != callGraph.indices.end()
+                        && calleeSet.insert(calleeIndex->second).second) {
+                        size_t callee = calleeIndex->second;
+
+                        callGraph.calleeIndices[caller].push_back(callee);
+                        callGraph.callerIndices[callee].push_back(caller);
+
+                        if (callee == caller) {
+                            callGraph.selfCalls[caller] = true;
+                        }
+                    }
+
+                    continue;
+                }
+
+                construct->forEachChild([&stack](Construct *child) {
+                    stack.push_back(child);
+                });
+            }
+        }
+
+        callGraph.computeComponents();
+
+        return callGraph;
+    }
+
+    CallGraph::CallGraph() :
+        nodes(),
+        indices(),
+        calleeIndices(),
+        callerIndices(),
+        components(),
+        componentIndices(),
+        selfCalls() {
+        //
+    }
+
+    const std::vector<Construct *> &CallGraph::getNodes() const noexcept {
+        return this->nodes;
+    }
+
+    bool CallGraph::contains(const Construct *construct) const {
+        return this->indices.find(construct) != this->indices.end();
+    }
+
+    std::vector<Construct *> CallGraph::getCallees(const Construct *construct) const {
+        auto index = this->indices.find(construct);
+
+        return index == this->indices.end()
+            ? std::vector<Construct *>{}
+            : this->resolveIndices(this->calleeIndices[index->second]);
+    }
+
+    std::vector<Construct *> CallGraph::getCallers(const Construct *construct) const {
+        auto index = this->indices.find(construct);
+
+        return index == this->indices.end()
+            ? std::vector<Construct *>{}
+            : this->resolveIndices(this->callerIndices[index->second]);
+    }
+
+    const std::vector<std::vector<Construct *>> &CallGraph::getComponents() const noexcept {
+        return this->components;
+    }
+
+    std::optional<size_t> CallGraph::findComponentIndex(const Construct *construct) const {
+        auto index = this->indices.find(construct);
+
+        if (index == this->indices.end()) {
+            return std::nullopt;
+        }
+
+        return this->componentIndices[index->second];
+    }
+
+    bool CallGraph::isRecursive(const Construct *construct) const {
+        auto index = this->indices.find(construct);
+
+        if (index == this->indices.end()) {
+            return false;
+        }
+
+        return this->selfCalls[index->second]
+            || this->components[this->componentIndices[index->second]].size() > 1;
+    }
+
+    std::vector<Construct *> CallGraph::getBottomUpOrder() const {
+        std::vector<Construct *> order = {};
+
+        order.reserve(this->nodes.size());
+
+        for (const auto &component : this->components) {
+            order.insert(order.end(), component.begin(), component.end());
+        }
+
+        return order;
+    }
+
+    std::vector<Construct *> CallGraph::getTopDownOrder() const {
+        std::vector<Construct *> order = this->getBottomUpOrder();
+
+        std::reverse(order.begin(), order.end());
+
+        return order;
+    }
+
+    CallGraphAnalysis::Result CallGraphAnalysis::run(
+        Construct *construct,
+        AnalysisManager &analysisManager
+    ) {
+        return CallGraph::build(construct->rawCast<Module>());
+    }
+}
@@ -0,0 +1,497 @@
+#include <limits>
+#include <ionlang/analysis/constant_evaluator.h>
+#include <ionlang/construct/value/boolean_literal.h>
+#include <ionlang/construct/value/integer_literal.h>
+
+namespace ionlang {
+    /**
+     * Booleans are evaluated as unsigned 1-bit integers, which matches
+     * their lowered representation.
+     */
+    static constexpr uint32_t booleanBitWidth = 1;
+
+    struct Arithmetic {
+        uint64_t bits;
+
+        bool isOverflow;
+    };
+
+    /**
+     * The operands and the operation's results are 64-bit values, which are
+     * wrapped around to the operands' width afterwards. Operands narrower
+     * than 64 bits cannot overflow 64 bits (barring unsigned subtraction),
+     * so the overflow of narrower operations is detected when wrapping.
+     */
+    static Arithmetic add(int64_t leftSide, int64_t rightSide, bool isSigned) {
+        uint64_t bits = static_cast<uint64_t>(leftSide) + static_cast<uint64_t>(rightSide);
+
+        if (isSigned) {
+            return Arithmetic{
+                bits,
+
+                (rightSide > 0 && leftSide > std::numeric_limits<int64_t>::max() - rightSide)
+                    || (rightSide < 0 && leftSide < std::numeric_limits<int64_t>::min() - rightSide)
+            };
+        }
+
+        return Arithmetic{bits, bits < static_cast<uint64_t>(leftSide)};
+    }
+
+    static Arithmetic subtract(int64_t leftSide, int64_t rightSide, bool isSigned) {
+        uint64_t bits = static_cast<uint64_t>(leftSide) - static_cast<uint64_t>(rightSide);
+
+        if (isSigned) {
+            return Arithmetic{
+                bits,
+
+                (rightSide < 0 && leftSide > std::numeric_limits<int64_t>::max() + rightSide)
+                    || (rightSide > 0 && leftSide < std::numeric_limits<int64_t>::min() + rightSide)
+            };
+        }
+
+        return Arithmetic{bits, static_cast<uint64_t>(leftSide) < static_cast<uint64_t>(rightSide)};
+    }
+
+    static Arithmetic multiply(int64_t leftSide, int64_t rightSide, bool isSigned) {
+        uint64_t bits = static_cast<uint64_t>(leftSide) * static_cast<uint64_t>(rightSide);
+
+        if (leftSide == 0) {
+            return Arithmetic{bits, false};
+        }
+        else if (isSigned) {
+            // Check for the only case in which the division below overflows first.
+            if (leftSide == -1) {
+                return Arithmetic{bits, rightSide == std::numeric_limits<int64_t>::min()};
+            }
+
+            return Arithmetic{bits, static_cast<int64_t>(bits) / leftSide != rightSide};
+        }
+
+        return Arithmetic{bits, bits / static_cast<uint64_t>(leftSide) != static_cast<uint64_t>(rightSide)};
+    }
+
+    /**
+     * An integer operation on operands of the same width and signedness.
+     */
+    class IntegerEvaluation {
+    private:
+        uint32_t bitWidth;
+
+        bool isSigned;
+
+        bool isOverflow;
+
+        int64_t wrap(const Arithmetic &arithmetic) {
+            int64_t result = ConstantEvaluator::normalize(arithmetic.bits, this->bitWidth, this->isSigned);
+
+            this->isOverflow = this->isOverflow
+                || arithmetic.isOverflow
+                || static_cast<uint64_t>(result) != arithmetic.bits;
+
+            return result;
+        }
+
+        int64_t power(int64_t base, uint64_t exponent) {
+            int64_t result = 1;
+
+            // Exponentiation by squaring, wrapping around on every step.
+            while (exponent != 0) {
+                if ((exponent & 1) != 0) {
+                    result = this->wrap(multiply(result, base, this->isSigned));
+                }
+
+                exponent >>= 1;
+
+                if (exponent != 0) {
+                    base = this->wrap(multiply(base, base, this->isSigned));
+                }
+            }
+
+            return result;
+        }
+
+    public:
+        IntegerEvaluation(uint32_t bitWidth, bool isSigned) :
+            bitWidth(bitWidth),
+            isSigned(isSigned),
+            isOverflow(false) {
+            //
+        }
+
+        /**
+         * Yields the resulting bits, or a status if the operation has
+         * no result.
+         */
+        std::variant<int64_t, EvaluationStatus> evaluate(
+            Operator operation,
+            int64_t leftSide,
+            int64_t rightSide
+        ) {
+            const uint64_t unsignedLeftSide = static_cast<uint64_t>(leftSide);
+            const uint64_t unsignedRightSide = static_cast<uint64_t>(rightSide);
+
+            switch (operation) {
+                case Operator::Addition: {
+                    return this->wrap(add(leftSide, rightSide, this->isSigned));
+                }
+
+                case Operator::Subtraction: {
+                    return this->wrap(subtract(leftSide, rightSide, this->isSigned));
+                }
+
+                case Operator::Multiplication: {
+                    return this->wrap(multiply(leftSide, rightSide, this->isSigned));
+                }
+
+                case Operator::Division: {
+                    if (rightSide == 0) {
+                        return EvaluationStatus::DivisionByZero;
+                    }
+                    else if (!this->isSigned) {
+                        return this->wrap(Arithmetic{unsignedLeftSide / unsignedRightSide, false});
+                    }
+                    // The only signed division which overflows (and would trap).
+                    else if (rightSide == -1) {
+                        return this->wrap(subtract(0, leftSide, true));
+                    }
+
+                    return this->wrap(Arithmetic{static_cast<uint64_t>(leftSide / rightSide), false});
+                }
+
+                case Operator::Modulo: {
+                    if (rightSide == 0) {
+                        return EvaluationStatus::DivisionByZero;
+                    }
+                    else if (!this->isSigned) {
+                        return this->wrap(Arithmetic{unsignedLeftSide % unsignedRightSide, false});
+                    }
+                    // Avoid trapping on the minimum value.
+                    else if (rightSide == -1) {
+                        return int64_t{0};
+                    }
+
+                    // Truncating, the result takes on the sign of the left side.
+                    return this->wrap(Arithmetic{static_cast<uint64_t>(leftSide % rightSide), false});
+                }
+
+                case Operator::Exponent: {
+                    // Negative exponents yield fractions, which are not integers.
+                    if (this->isSigned && rightSide < 0) {
+                        return EvaluationStatus::Unsupported;
+                    }
+
+                    return this->power(leftSide, unsignedRightSide);
+                }
+
+                case Operator::ShiftLeft: {
+                    // Shifting by the width or beyond has no defined result.
+                    if (unsignedRightSide >= this->bitWidth) {
+                        return EvaluationStatus::Unsupported;
+                    }
+
+                    // Bits shifted out are discarded, which is not an overflow.
+                    return ConstantEvaluator::normalize(
+                        unsignedLeftSide << unsignedRightSide,
+                        this->bitWidth,
+                        this->isSigned
+                    );
+                }
+
+                case Operator::ShiftRight: {
+                    if (unsignedRightSide >= this->bitWidth) {
+                        return EvaluationStatus::Unsupported;
+                    }
+
+                    // The operands are already sign-extended or zero-extended to 64 bits.
+                    uint64_t bits = this->isSigned
+                        ? static_cast<uint64_t>(leftSide >> unsignedRightSide)
+                        : unsignedLeftSide >> unsignedRightSide;
+
+                    return ConstantEvaluator::normalize(bits, this->bitWidth, this->isSigned);
+                }
+
+                case Operator::BitwiseAnd: {
+                    return ConstantEvaluator::normalize(
+                        unsignedLeftSide & unsignedRightSide,
+                        this->bitWidth,
+                        this->isSigned
+                    );
+                }
+
+                default: {
+                    return EvaluationStatus::Unsupported;
+                }
+            }
+        }
+
+        [[nodiscard]] bool getIsOverflow() const noexcept {
+            return this->isOverflow;
+        }
+    };
+
+    /**
+     * Compare two operands of the same width and signedness.
+     */
+    static std::optional<bool> compare(
+        Operator operation,
+        int64_t leftSide,
+        int64_t rightSide,
+        bool isSigned
+    ) {
+        switch (operation) {
+            case Operator::LessThan: {
+                return isSigned
+                    ? leftSide < rightSide
+                    : static_cast<uint64_t>(leftSide) < static_cast<uint64_t>(rightSide);
+            }
+
+            case Operator::GreaterThan: {
+                return isSigned
+                    ? leftSide > rightSide
+                    : static_cast<uint64_t>(leftSide) > static_cast<uint64_t>(rightSide);
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    std::optional<uint32_t> ConstantEvaluator::findBitWidth(const IntegerType &type) noexcept {
+        switch (type.integerKind) {
+            case IntegerKind::Int8:
+            case IntegerKind::Int16:
+            case IntegerKind::Int32:
+            case IntegerKind::Int64: {
+                return static_cast<uint32_t>(type.integerKind);
+            }
+
+            // Values of wider integers cannot be held by literals.
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    int64_t ConstantEvaluator::normalize(uint64_t bits, uint32_t bitWidth, bool isSigned) noexcept {
+        if (bitWidth >= 64) {
+            return static_cast<int64_t>(bits);
+        }
+
+        const uint64_t mask = (uint64_t{1} << bitWidth) - 1;
+
+        bits &= mask;
+
+        // Extend the sign bit onto the upper bits.
+        if (isSigned && ((bits >> (bitWidth - 1)) & 1) != 0) {
+            bits |= ~mask;
+        }
+
+        return static_cast<int64_t>(bits);
+    }
+
+    std::optional<Constant> ConstantEvaluator::findConstant(Construct *construct) {
+        if (construct == nullptr || construct->constructKind != ConstructKind::Value) {
+            return std::nullopt;
+        }
+
+        switch (construct->rawCast<Value<>>()->getValueKind()) {
+            case ValueKind::Integer: {
+                IntegerLiteral *integerLiteral = construct->rawCast<IntegerLiteral>();
+
+                if (integerLiteral->type == nullptr) {
+                    return std::nullopt;
+                }
+
+                std::optional<uint32_t> bitWidth =
+                    ConstantEvaluator::findBitWidth(*integerLiteral->type);
+
+                if (!bitWidth.has_value()) {
+                    return std::nullopt;
+                }
+
+                return IntegerConstant{
+                    integerLiteral->type,
+
+                    ConstantEvaluator::normalize(
+                        static_cast<uint64_t>(integerLiteral->value),
+                        *bitWidth,
+                        integerLiteral->type->isSigned
+                    )
+                };
+            }
+
+            case ValueKind::Boolean: {
+                return construct->rawCast<BooleanLiteral>()->value;
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    ionshared::Ptr<Construct> ConstantEvaluator::makeLiteral(
+        const Constant &constant,
+        const ionshared::Ptr<TypeContext> &typeContext
+    ) {
+        if (std::holds_alternative<bool>(constant)) {
+            return std::make_shared<BooleanLiteral>(std::get<bool>(constant), typeContext->getBooleanType());
+        }
+
+        const IntegerConstant &integerConstant = std::get<IntegerConstant>(constant);
+
+        return std::make_shared<IntegerLiteral>(integerConstant.type, integerConstant.value);
+    }
+
+    bool ConstantEvaluator::isEqual(const Constant &first, const Constant &second) noexcept {
+        if (first.index() != second.index()) {
+            return false;
+        }
+        else if (std::holds_alternative<bool>(first)) {
+            return std::get<bool>(first) == std::get<bool>(second);
+        }
+
+        const IntegerConstant &firstInteger = std::get<IntegerConstant>(first);
+        const IntegerConstant &secondInteger = std::get<IntegerConstant>(second);
+
+        return firstInteger.value == secondInteger.value
+            && firstInteger.type->integerKind == secondInteger.type->integerKind
+            && firstInteger.type->isSigned == secondInteger.type->isSigned;
+    }
+
+    EvaluationResult ConstantEvaluator::evaluateBinary(
+        Operator operation,
+        const Constant &leftSide,
+        const Constant &rightSide
+    ) {
+        if (leftSide.index() != rightSide.index()) {
+            return EvaluationResult{EvaluationStatus::Unsupported};
+        }
+
+        uint32_t bitWidth = booleanBitWidth;
+        bool isSigned = false;
+        int64_t leftValue;
+        int64_t rightValue;
+
+        if (std::holds_alternative<bool>(leftSide)) {
+            leftValue = std::get<bool>(leftSide) ? 1 : 0;
+            rightValue = std::get<bool>(rightSide) ? 1 : 0;
+        }
+        else {
+            const IntegerConstant &leftInteger = std::get<IntegerConstant>(leftSide);
+            const IntegerConstant &rightInteger = std::get<IntegerConstant>(rightSide);
+
+            // Implicit conversions are not performed.
+            if (leftInteger.type->integerKind != rightInteger.type->integerKind
+                || leftInteger.type->isSigned != rightInteger.type->isSigned) {
+                return EvaluationResult{EvaluationStatus::Unsupported};
+            }
+
+            std::optional<uint32_t> integerBitWidth =
+                ConstantEvaluator::findBitWidth(*leftInteger.type);
+
+            if (!integerBitWidth.has_value()) {
+                return EvaluationResult{EvaluationStatus::Unsupported};
+            }
+
+            bitWidth = *integerBitWidth;
+            isSigned = leftInteger.type->isSigned;
+            leftValue = leftInteger.value;
+            rightValue = rightInteger.value;
+        }
+
+        std::optional<bool> comparison = compare(operation, leftValue, rightValue, isSigned);
+
+        if (comparison.has_value()) {
+            return EvaluationResult{EvaluationStatus::Success, *comparison};
+        }
+
+        IntegerEvaluation evaluation = IntegerEvaluation(bitWidth, isSigned);
+        std::variant<int64_t, EvaluationStatus> result =
+            evaluation.evaluate(operation, leftValue, rightValue);
+
+        if (std::holds_alternative<EvaluationStatus>(result)) {
+            return EvaluationResult{std::get<EvaluationStatus>(result)};
+        }
+
+        EvaluationStatus status = evaluation.getIsOverflow()
+            ? EvaluationStatus::Overflow
+            : EvaluationStatus::Success;
+
+        if (std::holds_alternative<bool>(leftSide)) {
+            return EvaluationResult{status, std::get<int64_t>(result) != 0};
+        }
+
+        return EvaluationResult{
+            status,
+            IntegerConstant{std::get<IntegerConstant>(leftSide).type, std::get<int64_t>(result)}
+        };
+    }
+
+    EvaluationResult ConstantEvaluator::evaluateUnary(Operator operation, const Constant &value) {
+        switch (operation) {
+            case Operator::Addition: {
+                return EvaluationResult{EvaluationStatus::Success, value};
+            }
+
+            // Negation, evaluated as a subtraction from zero.
+            case Operator::Subtraction: {
+                Constant zero = std::holds_alternative<bool>(value)
+                    ? Constant{false}
+                    : Constant{IntegerConstant{std::get<IntegerConstant>(value).type, 0}};
+
+                return ConstantEvaluator::evaluateBinary(Operator::Subtraction, zero, value);
+            }
+
+            default: {
+                return EvaluationResult{EvaluationStatus::Unsupported};
+            }
+        }
+    }
+
+    std::optional<EvaluationResult> ConstantEvaluator::evaluate(Expression *expression) {
+        switch (expression->expressionKind) {
+            case ExpressionKind::BinaryOperation: {
+                BinaryOperation *binaryOperation = expression->rawCast<BinaryOperation>();
+
+                if (!binaryOperation->hasRightSide()) {
+                    return std::nullopt;
+                }
+
+                std::optional<Constant> leftSide =
+                    ConstantEvaluator::findConstant(binaryOperation->getLeftSide().get());
+
+                std::optional<Constant> rightSide =
+                    ConstantEvaluator::findConstant(binaryOperation->getRightSide()->get());
+
+                if (!leftSide.has_value() || !rightSide.has_value()) {
+                    return std::nullopt;
+                }
+
+                return ConstantEvaluator::evaluateBinary(
+                    binaryOperation->getOperator(),
+                    *leftSide,
+                    *rightSide
+                );
+            }
+
+            case ExpressionKind::UnaryOperation: {
+                UnaryOperation *unaryOperation = expression->rawCast<UnaryOperation>();
+
+                std::optional<Constant> value =
+                    ConstantEvaluator::findConstant(unaryOperation->getValue().get());
+
+                if (!value.has_value()) {
+                    return std::nullopt;
+                }
+
+                return ConstantEvaluator::evaluateUnary(unaryOperation->getOperator(), *value);
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+}
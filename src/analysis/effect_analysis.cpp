@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <ionlang/passes/pass.h>
+#include <ionlang/analysis/effect_analysis.h>
+
+namespace ionlang {
+    Effect EffectSummary::findExternEffect(const Extern *externConstruct) {
+        if (externConstruct->hasAttribute(EffectSummary::pureAttributeName)) {
+            return Effect::Pure;
+        }
+        else if (externConstruct->hasAttribute(EffectSummary::readOnlyAttributeName)) {
+            return Effect::ReadOnly;
+        }
+
+        return Effect::SideEffecting;
+    }
+
+    EffectSummary EffectSummary::build(const CallGraph &callGraph) {
+        EffectSummary effectSummary = EffectSummary();
+        std::vector<Construct *> stack = {};
+
+        // Callees precede their callers, barring those within the same component.
+        for (const auto &component : callGraph.getComponents()) {
+            Effect effect = Effect::Pure;
+
+            for (Construct *node : component) {
+                if (node->constructKind == ConstructKind::Extern) {
+                    effect = std::max(effect, EffectSummary::findExternEffect(node->rawCast<Extern>()));
+
+                    continue;
+                }
+
+                stack.push_back(node->rawCast<Function>()->body.get());
+
+                while (!stack.empty() && effect != Effect::SideEffecting) {
+                    Construct *construct = stack.back();
+
+                    stack.pop_back();
+
+                    if (construct->constructKind == ConstructKind::Ref) {
+                        auto ref = construct->rawCast<Ref<>>();
+
+                        if (ref->refKind != RefKind::Function) {
+                            continue;
+                        }
+                        else if (!ref->isResolved() || !callGraph.contains(ref->value->get())) {
+                            effect = Effect::SideEffecting;
+                        }
+                        // Calls within the component are accounted for once it is complete.
+                        else if (callGraph.findComponentIndex(ref->value->get())
+                            != callGraph.findComponentIndex(node)) {
+                            effect = std::max(effect, effectSummary.getEffect(ref->value->get()));
+                        }
+
+                        continue;
+                    }
+
+                    construct->forEachChild([&stack](Construct *child) {
+                        stack.push_back(child);
+                    });
+                }
+
+                stack.clear();
+            }
+
+            for (Construct *node : component) {
+                effectSummary.effects[node] = effect;
+            }
+        }
+
+        return effectSummary;
+    }
+
+    EffectSummary::EffectSummary() :
+        effects() {
+        //
+    }
+
+    Effect EffectSummary::getEffect(const Construct *construct) const {
+        auto effect = this->effects.find(construct);
+
+        return effect == this->effects.end() ? Effect::SideEffecting : effect->second;
+    }
+
+    bool EffectSummary::isPure(const Construct *construct) const {
+        return this->getEffect(construct) == Effect::Pure;
+    }
+
+    EffectAnalysis::Result EffectAnalysis::run(
+        Construct *construct,
+        AnalysisManager &analysisManager
+    ) {
+        return EffectSummary::build(*analysisManager.get<CallGraphAnalysis>(construct));
+    }
+}
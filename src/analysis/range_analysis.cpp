@@ -0,0 +1,482 @@
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <ionlang/passes/pass.h>
+#include <ionlang/analysis/constant_evaluator.h>
+#include <ionlang/analysis/range_analysis.h>
+
+namespace ionlang {
+    static std::optional<int64_t> checkedAdd(int64_t leftSide, int64_t rightSide) {
+        if ((rightSide > 0 && leftSide > std::numeric_limits<int64_t>::max() - rightSide)
+            || (rightSide < 0 && leftSide < std::numeric_limits<int64_t>::min() - rightSide)) {
+            return std::nullopt;
+        }
+
+        return leftSide + rightSide;
+    }
+
+    static std::optional<int64_t> checkedSubtract(int64_t leftSide, int64_t rightSide) {
+        if ((rightSide < 0 && leftSide > std::numeric_limits<int64_t>::max() + rightSide)
+            || (rightSide > 0 && leftSide < std::numeric_limits<int64_t>::min() + rightSide)) {
+            return std::nullopt;
+        }
+
+        return leftSide - rightSide;
+    }
+
+    static std::optional<int64_t> checkedMultiply(int64_t leftSide, int64_t rightSide) {
+        if (leftSide == 0 || rightSide == 0) {
+            return 0;
+        }
+        else if ((leftSide == -1 && rightSide == std::numeric_limits<int64_t>::min())
+            || (rightSide == -1 && leftSide == std::numeric_limits<int64_t>::min())) {
+            return std::nullopt;
+        }
+
+        auto result = static_cast<int64_t>(static_cast<uint64_t>(leftSide) * static_cast<uint64_t>(rightSide));
+
+        if (result / rightSide != leftSide) {
+            return std::nullopt;
+        }
+
+        return result;
+    }
+
+    /**
+     * The smallest range containing the results of the operation on
+     * each pair of bounds. Returns std::nullopt if any of them overflows
+     * 64 bits. Suitable for operations which are monotonic on each side.
+     */
+    template<typename TOperation>
+    static std::optional<IntegerRange> combineBounds(
+        const IntegerRange &leftSide,
+        const IntegerRange &rightSide,
+        TOperation operation
+    ) {
+        std::optional<IntegerRange> result = std::nullopt;
+
+        for (const int64_t leftBound : {leftSide.min, leftSide.max}) {
+            for (const int64_t rightBound : {rightSide.min, rightSide.max}) {
+                std::optional<int64_t> value = operation(leftBound, rightBound);
+
+                if (!value.has_value()) {
+                    return std::nullopt;
+                }
+
+                result = result.has_value()
+                    ? IntegerRange{std::min(result->min, *value), std::max(result->max, *value)}
+                    : IntegerRange{*value, *value};
+            }
+        }
+
+        return result;
+    }
+
+    std::optional<IntegerRange> IntegerRange::findTypeRange(const IntegerType &type) {
+        std::optional<uint32_t> bitWidth = ConstantEvaluator::findBitWidth(type);
+
+        if (!bitWidth.has_value() || (!type.isSigned && *bitWidth == 64)) {
+            return std::nullopt;
+        }
+        else if (type.isSigned) {
+            int64_t max = static_cast<int64_t>((uint64_t{1} << (*bitWidth - 1)) - 1);
+
+            return IntegerRange{-max - 1, max};
+        }
+
+        return IntegerRange{0, static_cast<int64_t>((uint64_t{1} << *bitWidth) - 1)};
+    }
+
+    bool IntegerRange::contains(const IntegerRange &other) const noexcept {
+        return this->min <= other.min && other.max <= this->max;
+    }
+
+    bool IntegerRange::operator==(const IntegerRange &other) const noexcept {
+        return this->min == other.min && this->max == other.max;
+    }
+
+    bool IntegerRange::operator!=(const IntegerRange &other) const noexcept {
+        return !(*this == other);
+    }
+
+    void IntegerRanges::collectDefinitions(
+        Block *block,
+        std::vector<std::pair<VariableDeclStatement *, Construct *>> &definitions
+    ) {
+        for (const auto &statement : block->statements) {
+            switch (statement->statementKind) {
+                case StatementKind::VariableDeclaration: {
+                    auto variableDecl = statement->rawCast<VariableDeclStatement>();
+
+                    definitions.emplace_back(variableDecl, variableDecl->value.get());
+
+                    break;
+                }
+
+                case StatementKind::Assignment: {
+                    auto assignment = statement->rawCast<AssignmentStatement>();
+
+                    if (assignment->variableDeclStatementRef->isResolved()) {
+                        definitions.emplace_back(
+                            assignment->variableDeclStatementRef->value->get(),
+                            assignment->value.get()
+                        );
+                    }
+
+                    break;
+                }
+
+                case StatementKind::If: {
+                    auto ifStatement = statement->rawCast<IfStatement>();
+
+                    IntegerRanges::collectDefinitions(ifStatement->consequentBlock.get(), definitions);
+
+                    if (ifStatement->hasAlternativeBlock()) {
+                        IntegerRanges::collectDefinitions(ifStatement->alternativeBlock->get(), definitions);
+                    }
+
+                    break;
+                }
+
+                case StatementKind::BlockWrapper: {
+                    IntegerRanges::collectDefinitions(
+                        statement->rawCast<BlockWrapperStatement>()->block.get(),
+                        definitions
+                    );
+
+                    break;
+                }
+
+                default: {
+                    break;
+                }
+            }
+        }
+    }
+
+    std::optional<IntegerRange> IntegerRanges::evaluate(Construct *value, bool isRecorded) {
+        if (value == nullptr || value->constructKind != ConstructKind::Value) {
+            return std::nullopt;
+        }
+
+        std::optional<IntegerRange> result = std::nullopt;
+
+        switch (value->rawCast<Value<>>()->getValueKind()) {
+            case ValueKind::Integer: {
+                auto integerLiteral = value->rawCast<IntegerLiteral>();
+
+                if (IntegerRange::findTypeRange(*integerLiteral->type).has_value()) {
+                    result = IntegerRange{integerLiteral->value, integerLiteral->value};
+                }
+
+                break;
+            }
+
+            case ValueKind::Expression: {
+                result = this->evaluateOperation(value->rawCast<Expression>(), isRecorded);
+
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        if (isRecorded && result.has_value()) {
+            this->ranges[value] = *result;
+        }
+
+        return result;
+    }
+
+    std::optional<IntegerRange> IntegerRanges::evaluateOperation(Expression *expression, bool isRecorded) {
+        std::optional<IntegerRange> leftSide = std::nullopt;
+        std::optional<IntegerRange> rightSide = std::nullopt;
+        Operator operation;
+
+        switch (expression->expressionKind) {
+            case ExpressionKind::VariableRef: {
+                PtrRef<VariableDeclStatement> variableDeclRef =
+                    expression->rawCast<VariableRefExpr>()->getVariableDecl();
+
+                if (!variableDeclRef->isResolved()) {
+                    return std::nullopt;
+                }
+
+                VariableDeclStatement *variableDecl = variableDeclRef->value->get();
+                auto range = this->ranges.find(variableDecl);
+
+                if (range != this->ranges.end()) {
+                    return range->second;
+                }
+                else if (variableDecl->type != nullptr && variableDecl->type->typeKind == TypeKind::Integer) {
+                    return IntegerRange::findTypeRange(*variableDecl->type->staticCast<IntegerType>());
+                }
+
+                return std::nullopt;
+            }
+
+            case ExpressionKind::Call: {
+                for (const auto &arg : expression->rawCast<CallExpr>()->args) {
+                    this->evaluate(arg.get(), isRecorded);
+                }
+
+                return std::nullopt;
+            }
+
+            case ExpressionKind::UnaryOperation: {
+                auto unaryOperation = expression->rawCast<UnaryOperation>();
+
+                operation = unaryOperation->getOperator();
+                rightSide = this->evaluate(unaryOperation->getValue().get(), isRecorded);
+
+                break;
+            }
+
+            case ExpressionKind::BinaryOperation: {
+                auto binaryOperation = expression->rawCast<BinaryOperation>();
+
+                operation = binaryOperation->getOperator();
+                leftSide = this->evaluate(binaryOperation->getLeftSide().get(), isRecorded);
+
+                if (binaryOperation->hasRightSide()) {
+                    rightSide = this->evaluate(binaryOperation->getRightSide()->get(), isRecorded);
+                }
+
+                break;
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+
+        ionshared::Ptr<Type> type = expression->type;
+
+        // Comparisons yield booleans, which have no range.
+        if (type == nullptr || type->typeKind != TypeKind::Integer) {
+            return std::nullopt;
+        }
+
+        std::optional<IntegerRange> typeRange = IntegerRange::findTypeRange(*type->staticCast<IntegerType>());
+
+        if (!typeRange.has_value()) {
+            return std::nullopt;
+        }
+
+        // Operands share the operation's type, and may hold any of its values if unknown.
+        bool isUnary = expression->expressionKind == ExpressionKind::UnaryOperation;
+        IntegerRange left = isUnary ? IntegerRange{0, 0} : leftSide.value_or(*typeRange);
+        IntegerRange right = rightSide.value_or(*typeRange);
+        std::optional<IntegerRange> result = std::nullopt;
+
+        switch (operation) {
+            // Unary plus and negation are evaluated as subtractions from zero.
+            case Operator::Addition: {
+                result = isUnary ? std::make_optional(right) : combineBounds(left, right, checkedAdd);
+
+                break;
+            }
+
+            case Operator::Subtraction: {
+                result = combineBounds(left, right, checkedSubtract);
+
+                break;
+            }
+
+            case Operator::Multiplication: {
+                result = combineBounds(left, right, checkedMultiply);
+
+                break;
+            }
+
+            case Operator::Division: {
+                // The divisor may be zero, in which case there is no result.
+                if (right.min <= 0 && right.max >= 0) {
+                    break;
+                }
+
+                result = combineBounds(left, right, [](int64_t dividend, int64_t divisor) -> std::optional<int64_t> {
+                    if (dividend == std::numeric_limits<int64_t>::min() && divisor == -1) {
+                        return std::nullopt;
+                    }
+
+                    return dividend / divisor;
+                });
+
+                break;
+            }
+
+            case Operator::Modulo: {
+                if ((right.min <= 0 && right.max >= 0) || right.min == std::numeric_limits<int64_t>::min()) {
+                    break;
+                }
+
+                // The remainder takes on the sign of the dividend, and is smaller than the divisor.
+                int64_t bound = std::max(std::abs(right.min), std::abs(right.max)) - 1;
+
+                result = IntegerRange{
+                    left.min >= 0 ? 0 : std::max(left.min, -bound),
+                    left.max <= 0 ? 0 : std::min(left.max, bound)
+                };
+
+                break;
+            }
+
+            case Operator::BitwiseAnd: {
+                // The result is no greater than any non-negative operand.
+                if (left.min >= 0 || right.min >= 0) {
+                    result = IntegerRange{
+                        0,
+
+                        left.min >= 0 && right.min >= 0
+                            ? std::min(left.max, right.max)
+                            : (left.min >= 0 ? left.max : right.max)
+                    };
+                }
+
+                break;
+            }
+
+            case Operator::ShiftLeft:
+            case Operator::ShiftRight: {
+                auto bitWidth = static_cast<int64_t>(*ConstantEvaluator::findBitWidth(*type->staticCast<IntegerType>()));
+
+                // Only shifts by a known amount are tracked.
+                if (right.min != right.max || right.min < 0 || right.min >= bitWidth) {
+                    break;
+                }
+
+                int64_t factor = int64_t{1} << right.min;
+
+                result = operation == Operator::ShiftRight
+                    ? std::make_optional(IntegerRange{left.min >> right.min, left.max >> right.min})
+                    : combineBounds(left, IntegerRange{factor, factor}, checkedMultiply);
+
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        if (result.has_value() && typeRange->contains(*result)) {
+            return result;
+        }
+
+        // The result may wrap around (or is otherwise unknown), and may thus be any value.
+        if (isRecorded) {
+            this->overflows.insert(expression);
+        }
+
+        return typeRange;
+    }
+
+    IntegerRanges IntegerRanges::build(Function *function) {
+        IntegerRanges integerRanges = IntegerRanges();
+        std::vector<std::pair<VariableDeclStatement *, Construct *>> definitions = {};
+
+        IntegerRanges::collectDefinitions(function->body.get(), definitions);
+
+        // Grow the ranges of the locals until they cover all their values.
+        for (uint32_t round = 0; ; round++) {
+            bool isChanged = false;
+
+            for (const auto &[variableDecl, value] : definitions) {
+                ionshared::Ptr<Type> type = variableDecl->type;
+
+                if (type == nullptr || type->typeKind != TypeKind::Integer) {
+                    continue;
+                }
+
+                std::optional<IntegerRange> typeRange =
+                    IntegerRange::findTypeRange(*type->staticCast<IntegerType>());
+
+                if (!typeRange.has_value()) {
+                    continue;
+                }
+
+                // Locals declared without a value may hold anything.
+                IntegerRange range = integerRanges.evaluate(value, false).value_or(*typeRange);
+                auto localRange = integerRanges.ranges.find(variableDecl);
+
+                if (localRange == integerRanges.ranges.end()) {
+                    integerRanges.ranges[variableDecl] = range;
+                    isChanged = true;
+
+                    continue;
+                }
+
+                IntegerRange merged = IntegerRange{
+                    std::min(localRange->second.min, range.min),
+                    std::max(localRange->second.max, range.max)
+                };
+
+                if (merged != localRange->second) {
+                    localRange->second = round < IntegerRanges::maxRounds ? merged : *typeRange;
+                    isChanged = true;
+                }
+            }
+
+            if (!isChanged) {
+                break;
+            }
+        }
+
+        for (const auto &[variableDecl, value] : definitions) {
+            integerRanges.evaluate(value, true);
+        }
+
+        // Values outside of assignments (ex. conditions) are recorded as well.
+        std::vector<Construct *> stack = {function->body.get()};
+
+        while (!stack.empty()) {
+            Construct *construct = stack.back();
+
+            stack.pop_back();
+
+            if (construct->constructKind == ConstructKind::Value) {
+                if (integerRanges.ranges.find(construct) == integerRanges.ranges.end()) {
+                    integerRanges.evaluate(construct, true);
+                }
+
+                continue;
+            }
+
+            construct->forEachChild([&stack](Construct *child) {
+                stack.push_back(child);
+            });
+        }
+
+        return integerRanges;
+    }
+
+    IntegerRanges::IntegerRanges() :
+        ranges(),
+        overflows() {
+        //
+    }
+
+    std::optional<IntegerRange> IntegerRanges::findRange(const Construct *construct) const {
+        auto range = this->ranges.find(construct);
+
+        if (range == this->ranges.end()) {
+            return std::nullopt;
+        }
+
+        return range->second;
+    }
+
+    bool IntegerRanges::mayOverflow(const Construct *operation) const {
+        return this->overflows.count(operation) != 0 || this->ranges.find(operation) == this->ranges.end();
+    }
+
+    RangeAnalysis::Result RangeAnalysis::run(
+        Construct *construct,
+        AnalysisManager &analysisManager
+    ) {
+        return IntegerRanges::build(construct->rawCast<Function>());
+    }
+}
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <ionlang/passes/pass.h>
+#include <ionlang/analysis/reachability_analysis.h>
+
+namespace ionlang {
+    bool ReachabilityAnalysis::isTracked(const Construct *construct) noexcept {
+        switch (construct->constructKind) {
+            case ConstructKind::Function:
+            case ConstructKind::Extern:
+            case ConstructKind::Global: {
+                return true;
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    bool ReachabilityAnalysis::isRoot(Construct *construct) {
+        const Attributable *attributable;
+
+        switch (construct->constructKind) {
+            case ConstructKind::Function: {
+                auto function = construct->rawCast<Function>();
+
+                if (function->prototype->name == ReachabilityAnalysis::entryPointName) {
+                    return true;
+                }
+
+                attributable = function;
+
+                break;
+            }
+
+            case ConstructKind::Extern: {
+                attributable = construct->rawCast<Extern>();
+
+                break;
+            }
+
+            case ConstructKind::Global: {
+                attributable = construct->rawCast<Global>();
+
+                break;
+            }
+
+            default: {
+                return false;
+            }
+        }
+
+        return attributable->hasAttribute(ReachabilityAnalysis::keepAttributeName)
+            || attributable->hasAttribute(ReachabilityAnalysis::exportAttributeName);
+    }
+
+    ReachabilityAnalysis::Result ReachabilityAnalysis::collect(
+        Module *module,
+        const std::vector<std::string> &rootNames
+    ) {
+        Result reachable = {};
+        std::vector<Construct *> worklist = {};
+
+        auto enqueue = [&reachable, &worklist](Construct *construct) {
+            if (reachable.insert(construct).second) {
+                worklist.push_back(construct);
+            }
+        };
+
+        module->symbolTable->forEach([&](const std::string &id, const ionshared::Ptr<Construct> &topLevelConstruct) {
+            if (!ReachabilityAnalysis::isTracked(topLevelConstruct.get())) {
+                return;
+            }
+
+            bool isNamedRoot = std::find(rootNames.begin(), rootNames.end(), id) != rootNames.end();
+
+            if (isNamedRoot || ReachabilityAnalysis::isRoot(topLevelConstruct.get())) {
+                enqueue(topLevelConstruct.get());
+            }
+        });
+
+        std::vector<Construct *> stack = {};
+
+        while (!worklist.empty()) {
+            stack.push_back(worklist.back());
+            worklist.pop_back();
+
+            // Walk the subtree, following the references found within it.
+            while (!stack.empty()) {
+                Construct *construct = stack.back();
+
+                stack.pop_back();
+
+                if (construct->constructKind == ConstructKind::Ref) {
+                    ionshared::OptPtr<Construct> value = construct->rawCast<Ref<>>()->value;
+
+                    if (ionshared::util::hasValue(value)
+                        && ReachabilityAnalysis::isTracked(value->get())) {
+                        enqueue(value->get());
+                    }
+
+                    continue;
+                }
+
+                construct->forEachChild([&stack](Construct *child) {
+                    stack.push_back(child);
+                });
+            }
+        }
+
+        return reachable;
+    }
+
+    ReachabilityAnalysis::Result ReachabilityAnalysis::run(
+        Construct *construct,
+        AnalysisManager &analysisManager
+    ) {
+        return ReachabilityAnalysis::collect(construct->rawCast<Module>());
+    }
+}
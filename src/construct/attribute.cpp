@@ -8,6 +8,24 @@ namespace ionlang {
     }
 
     void Attribute::accept(Pass &visitor) {
-        visitor.visitAttribute(this->dynamicCast<Attribute>());
+        visitor.visitAttribute(this);
+    }
+
+    bool Attributable::hasAttribute(std::string_view name) const noexcept {
+        for (const auto &attribute : this->attributes) {
+            if (attribute->name == name) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Attributable::setAttributes(const ionshared::Ptr<Construct> &owner, Attributes attributes) {
+        for (const auto &attribute : attributes) {
+            attribute->parent = owner;
+        }
+
+        this->attributes = std::move(attributes);
     }
 }
@@ -6,42 +6,66 @@ namespace ionlang {
     Block::Block(
         ionshared::Ptr<Construct> parent,
         std::vector<ionshared::Ptr<Statement>> statements,
-        const ionshared::PtrSymbolTable<VariableDeclStatement> &symbolTable
+        PtrFlatSymbolTable<VariableDeclStatement> symbolTable
     ) :
         ConstructWithParent<Construct>(std::move(parent), ConstructKind::Block),
-        ionshared::Scoped<VariableDeclStatement>(symbolTable),
-        statements(std::move(statements)) {
-        //
+        statements(std::move(statements)),
+        symbolTable(std::move(symbolTable)) {
+        for (const auto &statement : this->statements) {
+            statement->adoptValues();
+        }
     }
 
     void Block::accept(Pass &visitor) {
         // TODO: Cast fails.
 //        visitor.visitScopeAnchor(this->dynamicCast<ionshared::Scoped<Construct>>());
-        visitor.visitBlock(this->dynamicCast<Block>());
+        visitor.visitBlock(this);
     }
 
-    Ast Block::getChildNodes() {
-        return Construct::convertChildren(this->statements);
+    void Block::forEachChild(const ChildCallback &callback) {
+        for (const auto &statement : this->statements) {
+            callback(statement.get());
+        }
     }
 
-    void Block::appendStatement(const ionshared::Ptr<Statement> &statement) {
-        this->statements.push_back(statement);
+    void Block::releaseChildren() {
+        this->statements.clear();
+        this->symbolTable->clear();
+    }
 
-        /**
-         * Variable declaration statements should be registered on
-         * the local symbol table.
-         */
-        if (statement->statementKind == StatementKind::VariableDeclaration) {
-            ionshared::Ptr<VariableDeclStatement> variableDecl =
-                statement->dynamicCast<VariableDeclStatement>();
+    bool Block::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        if (replacement == nullptr || replacement->constructKind != ConstructKind::Statement) {
+            return false;
+        }
 
-            this->symbolTable->set(variableDecl->name, variableDecl);
+        for (auto &statement : this->statements) {
+            if (statement.get() != child) {
+                continue;
+            }
+
+            this->unregisterStatement(statement);
+            statement = replacement->staticCast<Statement>();
+            statement->parent = this->staticCast<Block>();
+            statement->adoptValues();
+            this->registerStatement(statement);
+            this->markModified();
+
+            return true;
         }
 
+        return false;
+    }
+
+    void Block::appendStatement(const ionshared::Ptr<Statement> &statement) {
+        this->statements.push_back(statement);
+        statement->adoptValues();
+        this->registerStatement(statement);
+        this->markModified();
+
         // TODO: What about other named statements? Currently there might be none -- but in the future this might be an edge case, it's really daunting to write checks for each named construct (also recall there's Identifier, so we can't just std::dynamic_pointer_cast<ionshared::Named>).
     }
 
-    bool Block::relocateStatement(size_t orderIndex, ionshared::Ptr<Block> target) {
+    bool Block::relocateStatement(size_t orderIndex, const ionshared::Ptr<Block> &target) {
         /**
          * The size of the local statements vector is less than
          * the provided index.
@@ -54,17 +78,7 @@ namespace ionlang {
             return false;
         }
 
-        // TODO: Relocate symbol table entries, but making a map Statement -> Vector<Symbol Table Key>. Remember statement is already registered on the local symbol table on the appendStatement() call.
-
-        /**
-         * NOTE: The statement is registered on foreign block's symbol
-         * table during this call.
-         */
-        target->appendStatement(this->statements[orderIndex]);
-
-        this->statements.erase(this->statements.begin() + orderIndex);
-
-        return true;
+        return this->relocateStatements(target, orderIndex, orderIndex + 1) == 1;
     }
 
     size_t Block::relocateStatements(
@@ -72,40 +86,89 @@ namespace ionlang {
         size_t from,
         std::optional<size_t> to
     ) {
-        bool areStatementsEmpty = this->statements.empty();
+        size_t end = to.value_or(this->statements.size());
 
-        if (to.has_value()) {
-            if (*to > from) {
-                throw std::out_of_range("To cannot be after from");
-            }
-            else if (!areStatementsEmpty && *to > this->statements.size() - 1) {
-                throw std::out_of_range("Provided order is outsize of bounds");
-            }
+        if (end < from) {
+            throw std::out_of_range("To cannot be before from");
+        }
+        else if (end > this->statements.size()) {
+            throw std::out_of_range("Provided order is outsize of bounds");
         }
+        else if (target.get() == this) {
+            throw std::invalid_argument("Cannot relocate statements onto the same block");
+        }
+
+        auto beginIterator = this->statements.begin() + from;
+        auto endIterator = this->statements.begin() + end;
+
+        target->statements.reserve(target->statements.size() + (end - from));
+
+        for (auto i = beginIterator; i != endIterator; i++) {
+            ionshared::Ptr<Statement> &statement = *i;
+
+            this->unregisterStatement(statement);
+            target->registerStatement(statement);
+            statement->parent = target;
+            statement->markModified();
+            target->statements.push_back(std::move(statement));
+        }
+
+        // Drop the moved-from range in a single shift.
+        this->statements.erase(beginIterator, endIterator);
+        this->markModified();
+        target->markModified();
+
+        return end - from;
+    }
 
-        if (!areStatementsEmpty && from > this->statements.size() - 1) {
+    void Block::insertStatements(size_t orderIndex, const std::vector<ionshared::Ptr<Statement>> &statements) {
+        if (orderIndex > this->statements.size()) {
             throw std::out_of_range("Provided order is outsize of bounds");
         }
 
-        size_t statementsRelocated = 0;
+        ionshared::Ptr<Block> self = this->staticCast<Block>();
 
-        auto toIterator = to.has_value()
-            ? this->statements.begin() + *to
-            : this->statements.end();
+        for (const auto &statement : statements) {
+            statement->parent = self;
+            statement->adoptValues();
+            this->registerStatement(statement);
+        }
 
-        for (auto i = this->statements.begin() + from; i != toIterator; i++) {
-            if (this->relocateStatement(i - this->statements.begin(), target)) {
-                statementsRelocated++;
-            }
+        this->statements.insert(
+            this->statements.begin() + orderIndex,
+            statements.begin(),
+            statements.end()
+        );
+
+        this->markModified();
+    }
+
+    size_t Block::removeStatements(size_t from, std::optional<size_t> to) {
+        size_t end = to.value_or(this->statements.size());
+
+        if (end < from) {
+            throw std::out_of_range("To cannot be before from");
+        }
+        else if (end > this->statements.size()) {
+            throw std::out_of_range("Provided order is outsize of bounds");
         }
 
-        return statementsRelocated;
+        auto beginIterator = this->statements.begin() + from;
+        auto endIterator = this->statements.begin() + end;
+
+        for (auto i = beginIterator; i != endIterator; i++) {
+            this->unregisterStatement(*i);
+        }
+
+        this->statements.erase(beginIterator, endIterator);
+        this->markModified();
+
+        return end - from;
     }
 
     ionshared::Ptr<Block> Block::slice(size_t from, std::optional<size_t> to) {
-        ionshared::Ptr<Block> newBlock = std::make_shared<Block>(Block{
-            this->getUnboxedParent()
-        });
+        ionshared::Ptr<Block> newBlock =
+            std::make_shared<Block>(this->getUnboxedParent());
 
         /**
          * NOTE: Index boundary checks are performed when relocation
@@ -171,29 +234,60 @@ namespace ionlang {
     }
 
     ionshared::OptPtr<Function> Block::findParentFunction() {
-        ionshared::OptPtr<Function> parentFunction = std::nullopt;
-        std::queue<ionshared::Ptr<ConstructWithParent<Block>>> childrenOfBlockQueue = {};
+        ionshared::Ptr<Construct> parent = this->parent.lock();
+
+        /**
+         * Walk up the tree. A block's parent is either the function
+         * itself, or a statement (ex. an if statement) whose own parent
+         * is the enclosing block.
+         */
+        while (parent != nullptr) {
+            if (parent->constructKind == ConstructKind::Function) {
+                return parent->staticCast<Function>();
+            }
+            else if (parent->constructKind != ConstructKind::Statement) {
+                break;
+            }
+
+            ionshared::Ptr<Block> enclosingBlock =
+                parent->rawCast<Statement>()->parent.lock();
 
-        childrenOfBlockQueue.push(this->staticCast<ConstructWithParent<Block>>());
+            if (enclosingBlock == nullptr) {
+                break;
+            }
 
-        while (!childrenOfBlockQueue.empty()) {
-            ionshared::Ptr<ConstructWithParent<Block>> childOfBlock =
-                childrenOfBlockQueue.front();
+            parent = enclosingBlock->parent.lock();
+        }
 
-            childrenOfBlockQueue.pop();
+        return std::nullopt;
+    }
 
-            ionshared::Ptr<Construct> parent = *childOfBlock->parent;
+    void Block::registerStatement(const ionshared::Ptr<Statement> &statement) {
+        /**
+         * Variable declaration statements should be registered on
+         * the local symbol table.
+         */
+        if (statement->statementKind == StatementKind::VariableDeclaration) {
+            ionshared::Ptr<VariableDeclStatement> variableDecl =
+                statement->staticCast<VariableDeclStatement>();
 
-            if (parent->constructKind == ConstructKind::Function) {
-                parentFunction = parent->dynamicCast<Function>();
+            this->symbolTable->set(variableDecl->name, variableDecl);
+        }
+    }
 
-                break;
-            }
-            else if (dynamic_cast<ConstructWithParent<Block> *>(parent.get())) {
-                childrenOfBlockQueue.push(parent->dynamicCast<ConstructWithParent<Block>>());
-            }
+    void Block::unregisterStatement(const ionshared::Ptr<Statement> &statement) {
+        if (statement->statementKind != StatementKind::VariableDeclaration) {
+            return;
         }
 
-        return parentFunction;
+        ionshared::Ptr<VariableDeclStatement> variableDecl =
+            statement->staticCast<VariableDeclStatement>();
+
+        const ionshared::Ptr<VariableDeclStatement> *localEntry =
+            this->symbolTable->find(variableDecl->name);
+
+        if (localEntry != nullptr && *localEntry == variableDecl) {
+            this->symbolTable->remove(variableDecl->name);
+        }
     }
 }
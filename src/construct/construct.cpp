@@ -1,5 +1,7 @@
+#include <atomic>
 #include <ionlang/const/const.h>
 #include <ionlang/passes/pass.h>
+#include <ionlang/type_system/type_context.h>
 
 namespace ionlang {
     Construct::Construct(
@@ -8,28 +10,154 @@ namespace ionlang {
         ionshared::OptPtr<Construct> parent
     ) :
         ionshared::BaseConstruct<Construct, ConstructKind>(kind, std::move(parent)),
-        sourceLocation(std::move(sourceLocation)) {
+        sourceLocation(std::move(sourceLocation)),
+        version(0),
+        treeVersion(0) {
         //
     }
 
-    Ast Construct::getChildNodes() {
+    void Construct::forEachChild(const ChildCallback &callback) {
+        // By default, construct contains no children.
+    }
+
+    bool Construct::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        return false;
+    }
+
+    void Construct::releaseChildren() {
         // By default, construct contains no children.
-        return {};
+    }
+
+    Ast Construct::getChildNodes() {
+        Ast children = {};
+
+        this->forEachChild([&children](Construct *child) {
+            children.push_back(child->nativeCast());
+        });
+
+        return children;
     }
 
     bool Construct::verify() {
-        Ast children = this->getChildNodes();
+        bool result = true;
 
-        for (const auto &child : children) {
-            if (!child->verify()) {
-                return false;
-            }
-        }
+        this->forEachChild([&result](Construct *child) {
+            result = result && child->verify();
+        });
 
-        return true;
+        return result;
     }
 
     std::optional<std::string> Construct::findConstructName() {
         return Const::getConstructKindName(this->constructKind);
     }
+
+    void Construct::teardown() {
+        std::vector<Construct *> stack = {this};
+
+        while (!stack.empty()) {
+            Construct *construct = stack.back();
+
+            stack.pop_back();
+
+            if (construct->constructKind == ConstructKind::Ref) {
+                construct->rawCast<Ref<>>()->removeValue();
+            }
+
+            construct->forEachChild([&stack](Construct *child) {
+                stack.push_back(child);
+            });
+        }
+
+        std::vector<ionshared::Ptr<Construct>> released = {};
+
+        this->forEachChild([&released](Construct *child) {
+            released.push_back(child->nativeCast());
+        });
+
+        this->releaseChildren();
+
+        while (!released.empty()) {
+            ionshared::Ptr<Construct> construct = std::move(released.back());
+
+            released.pop_back();
+
+            // Still owned elsewhere, therefore not freed here.
+            if (construct.use_count() > 1) {
+                continue;
+            }
+
+            construct->forEachChild([&released](Construct *child) {
+                released.push_back(child->nativeCast());
+            });
+
+            // Freed once out of scope, without any children left to recurse into.
+            construct->releaseChildren();
+        }
+    }
+
+    void Construct::markModified() noexcept {
+        this->version++;
+
+        /**
+         * Modifications may affect analyses of other constructs within
+         * the same tree (ex. relocating a statement changes the parent
+         * function of the blocks within it), but not of other trees.
+         */
+        this->findTreeRoot()->treeVersion.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    Construct *Construct::findParent() noexcept {
+        return nullptr;
+    }
+
+    Construct *Construct::findTreeRoot() noexcept {
+        Construct *root = this;
+
+        // Parents outlive their attached children, so the links remain valid.
+        for (Construct *parent = root->findParent(); parent != nullptr; parent = root->findParent()) {
+            root = parent;
+        }
+
+        return root;
+    }
+
+    uint64_t Construct::getTreeVersion() noexcept {
+        return this->findTreeRoot()->treeVersion.load(std::memory_order_acquire);
+    }
+
+    ionshared::Ptr<TypeContext> Construct::findTypeContext() noexcept {
+        Construct *root = this->findTreeRoot();
+
+        return root->constructKind == ConstructKind::Module
+            ? root->rawCast<Module>()->typeContext
+            : TypeContext::getDefault();
+    }
+
+    void Construct::adoptValue(Construct *child) {
+        std::vector<std::pair<Construct *, Construct *>> stack = {{this, child}};
+
+        while (!stack.empty()) {
+            auto [parent, value] = stack.back();
+
+            stack.pop_back();
+
+            if (value->constructKind != ConstructKind::Value
+                || value->rawCast<Value<>>()->getValueKind() != ValueKind::Expression) {
+                continue;
+            }
+
+            value->rawCast<Expression>()->parent = parent->nativeCast();
+
+            value->forEachChild([value, &stack](Construct *nestedChild) {
+                stack.emplace_back(value, nestedChild);
+            });
+        }
+    }
+
+    void Construct::adoptValues() {
+        this->forEachChild([this](Construct *child) {
+            this->adoptValue(child);
+        });
+    }
 }
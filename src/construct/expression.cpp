@@ -3,12 +3,17 @@
 namespace ionlang {
     Expression::Expression(ExpressionKind kind, ionshared::Ptr<Type> type) :
         Value<>(ValueKind::Expression, std::move(type)),
-        expressionKind(kind) {
+        expressionKind(kind),
+        parent() {
         //
     }
 
     void Expression::accept(Pass &visitor) {
         // TODO: Verify this works.
-        visitor.visitExpression(this->dynamicCast<Expression>());
+        visitor.visitExpression(this);
+    }
+
+    Construct *Expression::findParent() noexcept {
+        return this->parent.lock().get();
     }
 }
@@ -9,6 +9,38 @@ namespace ionlang {
         //
     }
 
+    void BinaryOperation::forEachChild(const ChildCallback &callback) {
+        callback(this->leftSide.get());
+
+        if (this->hasRightSide()) {
+            callback(this->rightSide->get());
+        }
+    }
+
+    void BinaryOperation::releaseChildren() {
+        this->leftSide = nullptr;
+        this->rightSide = std::nullopt;
+    }
+
+    bool BinaryOperation::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        Construct *adoptedChild = replacement.get();
+
+        if (this->leftSide.get() == child) {
+            this->leftSide = std::move(replacement);
+        }
+        else if (this->hasRightSide() && this->rightSide->get() == child) {
+            this->rightSide = std::move(replacement);
+        }
+        else {
+            return false;
+        }
+
+        this->adoptValue(adoptedChild);
+        this->markModified();
+
+        return true;
+    }
+
     Operator BinaryOperation::getOperator() const noexcept {
         return this->operation;
     }
@@ -21,16 +53,21 @@ namespace ionlang {
         return this->leftSide;
     }
 
-    void BinaryOperation::setLeftSide(ionshared::Ptr<Construct> leftSide) noexcept {
+    void BinaryOperation::setLeftSide(ionshared::Ptr<Construct> leftSide) {
         this->leftSide = std::move(leftSide);
+        this->adoptValue(this->leftSide.get());
     }
 
     ionshared::OptPtr<Construct> BinaryOperation::getRightSide() const noexcept {
         return this->rightSide;
     }
 
-    void BinaryOperation::setRightSide(ionshared::OptPtr<Construct> rightSide) noexcept {
+    void BinaryOperation::setRightSide(ionshared::OptPtr<Construct> rightSide) {
         this->rightSide = std::move(rightSide);
+
+        if (this->hasRightSide()) {
+            this->adoptValue(this->rightSide->get());
+        }
     }
 
     bool BinaryOperation::hasRightSide() const noexcept {
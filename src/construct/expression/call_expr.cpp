@@ -1,4 +1,5 @@
 #include <utility>
+#include <ionlang/misc/util.h>
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
@@ -12,12 +13,38 @@ namespace ionlang {
     }
 
     void CallExpr::accept(Pass &visitor) {
-        visitor.visitCallExpr(this->dynamicCast<CallExpr>());
+        visitor.visitCallExpr(this);
     }
 
-    Ast CallExpr::getChildNodes() {
-        return {
-            this->calleeRef
-        };
+    void CallExpr::forEachChild(const ChildCallback &callback) {
+        callback(this->calleeRef.get());
+
+        for (const auto &arg : this->args) {
+            callback(arg.get());
+        }
+    }
+
+    void CallExpr::releaseChildren() {
+        this->args.clear();
+    }
+
+    bool CallExpr::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        ionshared::Ptr<Value<>> value = util::tryCastValue(replacement);
+
+        if (value == nullptr) {
+            return false;
+        }
+
+        for (auto &arg : this->args) {
+            if (arg.get() == child) {
+                arg = std::move(value);
+                this->adoptValue(arg.get());
+                this->markModified();
+
+                return true;
+            }
+        }
+
+        return false;
     }
 }
@@ -11,6 +11,26 @@ namespace ionlang {
         value(std::move(value)) {
     }
 
+    void UnaryOperation::forEachChild(const ChildCallback &callback) {
+        callback(this->value.get());
+    }
+
+    void UnaryOperation::releaseChildren() {
+        this->value = nullptr;
+    }
+
+    bool UnaryOperation::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        if (this->value.get() != child) {
+            return false;
+        }
+
+        this->value = std::move(replacement);
+        this->adoptValue(this->value.get());
+        this->markModified();
+
+        return true;
+    }
+
     Operator UnaryOperation::getOperator() const noexcept {
         return this->operation;
     }
@@ -23,7 +43,8 @@ namespace ionlang {
         return this->value;
     }
 
-    void UnaryOperation::setValue(ionshared::Ptr<Construct> value) noexcept {
+    void UnaryOperation::setValue(ionshared::Ptr<Construct> value) {
         this->value = std::move(value);
+        this->adoptValue(this->value.get());
     }
 }
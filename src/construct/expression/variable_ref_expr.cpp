@@ -3,14 +3,18 @@
 
 namespace ionlang {
     VariableRefExpr::VariableRefExpr(PtrRef<VariableDeclStatement> variableDecl) :
-        // TODO: Expression requires 'type' but since the callee is a PtrRef, it's type is not necessarily resolved yet. What to do?
-        Expression(ExpressionKind::Call, nullptr),
+        // TODO: Expression requires 'type' but since the variable declaration is a PtrRef, it's type is not necessarily resolved yet. What to do?
+        Expression(ExpressionKind::VariableRef, nullptr),
         variableDecl(std::move(variableDecl)) {
         //
     }
 
     void VariableRefExpr::accept(Pass &visitor) {
-        visitor.visitVariableRefExpr(this->dynamicCast<VariableRefExpr>());
+        visitor.visitVariableRefExpr(this);
+    }
+
+    void VariableRefExpr::forEachChild(const ChildCallback &callback) {
+        callback(this->variableDecl.get());
     }
 
     PtrRef<VariableDeclStatement> VariableRefExpr::getVariableDecl() const noexcept {
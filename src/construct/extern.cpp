@@ -8,12 +8,14 @@ namespace ionlang {
     }
 
     void Extern::accept(Pass &visitor) {
-        visitor.visitExtern(this->dynamicCast<Extern>());
+        visitor.visitExtern(this);
     }
 
-    Ast Extern::getChildNodes() {
-        return {
-            this->prototype->nativeCast()
-        };
+    void Extern::forEachChild(const ChildCallback &callback) {
+        for (const auto &attribute : this->attributes) {
+            callback(attribute.get());
+        }
+
+        callback(this->prototype.get());
     }
 }
@@ -13,13 +13,20 @@ namespace ionlang {
     }
 
     void Function::accept(Pass &visitor) {
-        visitor.visitFunction(this->dynamicCast<Function>());
+        visitor.visitFunction(this);
     }
 
-    Ast Function::getChildNodes() {
-        return {
-            this->prototype->nativeCast(),
-            this->body->nativeCast()
-        };
+    void Function::forEachChild(const ChildCallback &callback) {
+        for (const auto &attribute : this->attributes) {
+            callback(attribute.get());
+        }
+
+        callback(this->prototype.get());
+        callback(this->body.get());
+    }
+
+    void Function::releaseChildren() {
+        this->prototype = nullptr;
+        this->body = nullptr;
     }
 }
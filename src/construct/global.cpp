@@ -1,3 +1,4 @@
+#include <ionlang/misc/util.h>
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
@@ -15,20 +16,36 @@ namespace ionlang {
     }
 
     void Global::accept(Pass &visitor) {
-        visitor.visitGlobal(this->dynamicCast<Global>());
+        visitor.visitGlobal(this);
     }
 
-    Ast Global::getChildNodes() {
-        Ast children = {
-            this->type->nativeCast()
-        };
+    void Global::forEachChild(const ChildCallback &callback) {
+        for (const auto &attribute : this->attributes) {
+            callback(attribute.get());
+        }
+
+        callback(this->type.get());
+
+        if (ionshared::util::hasValue(this->value)) {
+            callback(this->value->get());
+        }
+    }
+
+    void Global::releaseChildren() {
+        this->value = std::nullopt;
+    }
 
-        auto e = this->type->nativeCast();
+    bool Global::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        ionshared::Ptr<Value<>> value = util::tryCastValue(replacement);
 
-        if (this->value.has_value()) {
-            children.push_back(this->value->get()->nativeCast());
+        if (!ionshared::util::hasValue(this->value) || this->value->get() != child || value == nullptr) {
+            return false;
         }
 
-        return children;
+        this->value = std::move(value);
+        this->adoptValue(this->value->get());
+        this->markModified();
+
+        return true;
     }
 }
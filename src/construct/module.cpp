@@ -1,21 +1,33 @@
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
-    Module::Module(std::string id, ionshared::Ptr<Context> context) :
+    Module::Module(
+        std::string id,
+        ionshared::Ptr<Context> context,
+        PtrFlatSymbolTable<Construct> symbolTable,
+        ionshared::Ptr<TypeContext> typeContext
+    ) :
         Construct(ConstructKind::Module),
         ionshared::Named{std::move(id)},
-        context(std::move(context)) {
+        context(std::move(context)),
+        symbolTable(std::move(symbolTable)),
+        pendingRefs(std::nullopt),
+        typeContext(std::move(typeContext)) {
         //
     }
 
     void Module::accept(Pass &visitor) {
-        visitor.visitModule(this->dynamicCast<Module>());
+        visitor.visitModule(this);
     }
 
-    Ast Module::getChildNodes() {
-        return Construct::convertChildren(
-            // TODO: What about normal scopes? Merge that with global scope. Or actually, module just uses global context, right?
-            this->context->getGlobalScope()
-        );
+    void Module::forEachChild(const ChildCallback &callback) {
+        this->symbolTable->forEach([&callback](const std::string &id, const ionshared::Ptr<Construct> &construct) {
+            callback(construct.get());
+        });
+    }
+
+    void Module::releaseChildren() {
+        this->symbolTable->clear();
+        this->pendingRefs = std::nullopt;
     }
 }
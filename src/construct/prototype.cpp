@@ -17,7 +17,7 @@ namespace ionlang {
     }
 
     void Prototype::accept(Pass &visitor) {
-        visitor.visitPrototype(this->dynamicCast<Prototype>());
+        visitor.visitPrototype(this);
     }
 
     std::optional<std::string> Prototype::getMangledId() {
@@ -40,14 +40,12 @@ namespace ionlang {
             << IONLANG_MANGLE_SEPARATOR
             << this->name;
 
-        auto argsMap = this->args->items->unwrap();
-
-        for (const auto &[id, arg] : argsMap) {
+        this->args->items->forEach([&mangledId](const std::string &id, const Arg &arg) {
             mangledId << IONLANG_MANGLE_SEPARATOR
                 << arg.first->name
                 << IONLANG_MANGLE_SEPARATOR
                 << arg.second;
-        }
+        });
 
         return mangledId.str();
     }
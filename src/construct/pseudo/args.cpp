@@ -1,7 +1,7 @@
 #include <ionlang/construct/pseudo/args.h>
 
 namespace ionlang {
-    Args::Args(ionshared::Ptr<ionshared::SymbolTable<Arg>> items, bool isVariable) :
+    Args::Args(ionshared::Ptr<FlatSymbolTable<Arg>> items, bool isVariable) :
         items(std::move(items)),
         isVariable(isVariable) {
         //
@@ -7,6 +7,6 @@ namespace ionlang {
     }
 
     void ErrorMarker::accept(Pass &visitor) {
-        visitor.visitErrorMarker(this->dynamicCast<ErrorMarker>());
+        visitor.visitErrorMarker(this);
     }
 }
@@ -10,12 +10,31 @@ namespace ionlang {
     }
 
     void AssignmentStatement::accept(Pass &visitor) {
-        visitor.visitAssignmentStatement(this->dynamicCast<AssignmentStatement>());
+        visitor.visitAssignmentStatement(this);
     }
 
-    Ast AssignmentStatement::getChildNodes() {
-        return {
-            this->variableDeclStatementRef
-        };
+    void AssignmentStatement::forEachChild(const ChildCallback &callback) {
+        callback(this->variableDeclStatementRef.get());
+
+        // The value may not be filled in yet.
+        if (this->value != nullptr) {
+            callback(this->value.get());
+        }
+    }
+
+    void AssignmentStatement::releaseChildren() {
+        this->value = nullptr;
+    }
+
+    bool AssignmentStatement::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        if (this->value == nullptr || this->value.get() != child) {
+            return false;
+        }
+
+        this->value = std::move(replacement);
+        this->adoptValue(this->value.get());
+        this->markModified();
+
+        return true;
     }
 }
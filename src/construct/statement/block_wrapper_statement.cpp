@@ -8,12 +8,14 @@ namespace ionlang {
     }
 
     void BlockWrapperStatement::accept(Pass &visitor) {
-        visitor.visitBlockWrapperStatement(this->dynamicCast<BlockWrapperStatement>());
+        visitor.visitBlockWrapperStatement(this);
     }
 
-    Ast BlockWrapperStatement::getChildNodes() {
-        return {
-            this->block
-        };
+    void BlockWrapperStatement::forEachChild(const ChildCallback &callback) {
+        callback(this->block.get());
+    }
+
+    void BlockWrapperStatement::releaseChildren() {
+        this->block = nullptr;
     }
 }
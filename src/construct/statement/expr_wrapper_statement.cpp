@@ -1,3 +1,4 @@
+#include <ionlang/misc/util.h>
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
@@ -8,20 +9,37 @@ namespace ionlang {
     }
 
     void ExprWrapperStatement::accept(Pass &visitor) {
-        visitor.visitExprWrapperStatement(this->dynamicCast<ExprWrapperStatement>());
+        visitor.visitExprWrapperStatement(this);
     }
 
-    Ast ExprWrapperStatement::getChildNodes() {
-        return {
-            this->expression
-        };
+    void ExprWrapperStatement::forEachChild(const ChildCallback &callback) {
+        callback(this->expression.get());
+    }
+
+    void ExprWrapperStatement::releaseChildren() {
+        this->expression = nullptr;
+    }
+
+    bool ExprWrapperStatement::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        ionshared::Ptr<Expression> expression = util::tryCastValue<Expression>(replacement);
+
+        if (this->expression.get() != child || expression == nullptr) {
+            return false;
+        }
+
+        this->expression = std::move(expression);
+        this->adoptValue(this->expression.get());
+        this->markModified();
+
+        return true;
     }
 
     ionshared::Ptr<Expression> ExprWrapperStatement::getExpression() const noexcept {
         return this->expression;
     }
 
-    void ExprWrapperStatement::setExpression(ionshared::Ptr<Expression> expression) noexcept {
+    void ExprWrapperStatement::setExpression(ionshared::Ptr<Expression> expression) {
         this->expression = std::move(expression);
+        this->adoptValue(this->expression.get());
     }
 }
@@ -10,13 +10,35 @@ namespace ionlang {
     }
 
     void IfStatement::accept(Pass &visitor) {
-        visitor.visitIfStatement(this->dynamicCast<IfStatement>());
+        visitor.visitIfStatement(this);
     }
 
-    Ast IfStatement::getChildNodes() {
-        return {
-            this->condition
-        };
+    void IfStatement::forEachChild(const ChildCallback &callback) {
+        callback(this->condition.get());
+        callback(this->consequentBlock.get());
+
+        if (this->hasAlternativeBlock()) {
+            callback(this->alternativeBlock->get());
+        }
+    }
+
+    void IfStatement::releaseChildren() {
+        this->condition = nullptr;
+        this->consequentBlock = nullptr;
+        this->alternativeBlock = std::nullopt;
+    }
+
+    bool IfStatement::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        // Only the condition may be replaced; blocks are modified in place.
+        if (this->condition.get() != child) {
+            return false;
+        }
+
+        this->condition = std::move(replacement);
+        this->adoptValue(this->condition.get());
+        this->markModified();
+
+        return true;
     }
 
     bool IfStatement::hasAlternativeBlock() const noexcept {
@@ -1,3 +1,4 @@
+#include <ionlang/misc/util.h>
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
@@ -8,17 +9,31 @@ namespace ionlang {
     }
 
     void ReturnStatement::accept(Pass &visitor) {
-        visitor.visitReturnStatement(this->dynamicCast<ReturnStatement>());
+        visitor.visitReturnStatement(this);
     }
 
-    Ast ReturnStatement::getChildNodes() {
-        if (!this->hasValue()) {
-            return Construct::getChildNodes();
+    void ReturnStatement::forEachChild(const ChildCallback &callback) {
+        if (this->hasValue()) {
+            callback(this->value->get());
         }
+    }
+
+    void ReturnStatement::releaseChildren() {
+        this->value = std::nullopt;
+    }
+
+    bool ReturnStatement::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        ionshared::Ptr<Expression> value = util::tryCastValue<Expression>(replacement);
+
+        if (!this->hasValue() || this->value->get() != child || value == nullptr) {
+            return false;
+        }
+
+        this->value = std::move(value);
+        this->adoptValue(this->value->get());
+        this->markModified();
 
-        return {
-            *this->value
-        };
+        return true;
     }
 
     bool ReturnStatement::hasValue() const noexcept {
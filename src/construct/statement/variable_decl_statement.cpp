@@ -10,6 +10,30 @@ namespace ionlang {
     }
 
     void VariableDeclStatement::accept(Pass &visitor) {
-        visitor.visitVariableDecl(this->dynamicCast<VariableDeclStatement>());
+        visitor.visitVariableDecl(this);
+    }
+
+    void VariableDeclStatement::forEachChild(const ChildCallback &callback) {
+        callback(this->type.get());
+
+        if (this->value != nullptr) {
+            callback(this->value.get());
+        }
+    }
+
+    void VariableDeclStatement::releaseChildren() {
+        this->value = nullptr;
+    }
+
+    bool VariableDeclStatement::replaceChild(Construct *child, ionshared::Ptr<Construct> replacement) {
+        if (this->value == nullptr || this->value.get() != child) {
+            return false;
+        }
+
+        this->value = std::move(replacement);
+        this->adoptValue(this->value.get());
+        this->markModified();
+
+        return true;
     }
 }
@@ -9,27 +9,22 @@ namespace ionlang {
     }
 
     void Struct::accept(Pass &visitor) {
-        visitor.visitStruct(this->dynamicCast<Struct>());
+        visitor.visitStruct(this);
     }
 
-    Ast Struct::getChildNodes() {
-        Ast children = {};
-        auto fieldsMap = this->fields->unwrap();
-
+    void Struct::forEachChild(const ChildCallback &callback) {
         // TODO: What about the field name?
-        for (const auto &[name, type] : fieldsMap) {
-            children.push_back(type);
-        }
-
-        return children;
+        this->fields->forEach([&callback](const std::string &name, const ionshared::Ptr<Type> &type) {
+            callback(type.get());
+        });
     }
 
-    bool Struct::containsField(std::string name) const {
-        return this->fields->contains(std::move(name));
+    bool Struct::containsField(std::string_view name) const {
+        return this->fields->contains(name);
     }
 
-    ionshared::OptPtr<Type> Struct::lookupField(std::string name) {
-        return this->fields->lookup(std::move(name));
+    ionshared::OptPtr<Type> Struct::lookupField(std::string_view name) {
+        return this->fields->lookup(name);
     }
 
     void Struct::setField(std::string name, ionshared::Ptr<Type> field) {
@@ -9,28 +9,50 @@ namespace ionlang {
     ) :
         Construct(ConstructKind::Type),
         ionshared::Named{std::move(id)},
+        qualifiers(std::move(qualifiers)),
         typeKind(kind),
-        qualifiers(std::move(qualifiers)) {
+        isInterned(false) {
         //
     }
 
     void Type::accept(Pass &visitor) {
-        visitor.visitType(this->dynamicCast<Type>());
+        visitor.visitType(this);
     }
 
     TypeKind Type::getTypeKind() const noexcept {
         return this->typeKind;
     }
 
-    bool Type::addQualifier(TypeQualifier qualifier) noexcept {
-        return this->qualifiers->add(qualifier);
+    bool Type::addQualifier(TypeQualifier qualifier) {
+        // Canonical instances are shared across the AST.
+        if (this->isInterned) {
+            throw std::runtime_error("Cannot qualify an interned type in place");
+        }
+
+        bool result = this->qualifiers->add(qualifier);
+
+        this->markModified();
+
+        return result;
     }
 
-    bool Type::removeQualifier(TypeQualifier qualifier) noexcept {
-        return this->qualifiers->remove(qualifier);
+    bool Type::removeQualifier(TypeQualifier qualifier) {
+        if (this->isInterned) {
+            throw std::runtime_error("Cannot unqualify an interned type in place");
+        }
+
+        bool result = this->qualifiers->remove(qualifier);
+
+        this->markModified();
+
+        return result;
     }
 
     bool Type::hasQualifier(TypeQualifier qualifier) const {
         return this->qualifiers->contains(qualifier);
     }
+
+    const TypeQualifiers *Type::getQualifiers() const noexcept {
+        return this->qualifiers.get();
+    }
 }
@@ -9,6 +9,6 @@ namespace ionlang {
     }
 
     void BooleanType::accept(Pass &pass) {
-        return pass.visitBooleanType(this->dynamicCast<BooleanType>());
+        return pass.visitBooleanType(this);
     }
 }
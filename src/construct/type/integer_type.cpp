@@ -10,6 +10,6 @@ namespace ionlang {
     }
 
     void IntegerType::accept(Pass &pass) {
-        return pass.visitIntegerType(this->dynamicCast<IntegerType>());
+        return pass.visitIntegerType(this);
     }
 }
@@ -8,6 +8,6 @@ namespace ionlang {
     }
 
     void VoidType::accept(Pass &pass) {
-        return pass.visitVoidType(this->dynamicCast<VoidType>());
+        return pass.visitVoidType(this);
     }
 }
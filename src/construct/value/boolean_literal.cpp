@@ -1,13 +1,19 @@
 #include <ionlang/passes/pass.h>
+#include <ionlang/type_system/type_factory.h>
 
 namespace ionlang {
     BooleanLiteral::BooleanLiteral(bool value) :
-        Value(ValueKind::Boolean, std::make_shared<BooleanType>()),
+        BooleanLiteral(value, type_factory::typeBoolean()) {
+        //
+    }
+
+    BooleanLiteral::BooleanLiteral(bool value, ionshared::Ptr<BooleanType> type) :
+        Value(ValueKind::Boolean, std::move(type)),
         value(value) {
         //
     }
 
     void BooleanLiteral::accept(Pass &visitor) {
-        visitor.visitBooleanLiteral(this->dynamicCast<BooleanLiteral>());
+        visitor.visitBooleanLiteral(this);
     }
 }
@@ -9,6 +9,6 @@ namespace ionlang {
     }
 
     void CharLiteral::accept(Pass &visitor) {
-        visitor.visitCharLiteral(this->dynamicCast<CharLiteral>());
+        visitor.visitCharLiteral(this);
     }
 }
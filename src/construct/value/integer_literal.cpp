@@ -7,6 +7,6 @@ namespace ionlang {
     }
 
     void IntegerLiteral::accept(Pass &visitor) {
-        visitor.visitIntegerLiteral(this->dynamicCast<IntegerLiteral>());
+        visitor.visitIntegerLiteral(this);
     }
 }
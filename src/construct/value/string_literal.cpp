@@ -9,6 +9,6 @@ namespace ionlang {
     }
 
     void StringLiteral::accept(Pass &visitor) {
-        visitor.visitStringLiteral(this->dynamicCast<StringLiteral>());
+        visitor.visitStringLiteral(this);
     }
 }
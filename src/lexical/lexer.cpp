@@ -3,6 +3,7 @@
 #define IONLANG_LEXER_INDEX_DEFAULT 0
 
 #include <ionlang/lexical/lexer.h>
+#include <ionlang/misc/profiler.h>
 
 namespace ionlang {
     Lexer::Lexer(const std::string &input) :
@@ -236,6 +237,8 @@ namespace ionlang {
     }
 
     std::vector<Token> Lexer::scan() {
+        ProfileScope profileScope = ProfileScope("Lexer::scan");
+
         // Reset index to avoid carrying over previous information.
         this->begin();
 
@@ -259,6 +262,8 @@ namespace ionlang {
             tokens.push_back(*token);
         }
 
+        profileScope.addNodes(tokens.size());
+
         return tokens;
     }
 }
@@ -0,0 +1,393 @@
+#include <ionlang/misc/util.h>
+#include <ionlang/passes/pass.h>
+#include <ionlang/misc/construct_cloner.h>
+
+namespace ionlang {
+    PtrRef<VariableDeclStatement> ConstructCloner::cloneVariableRef(
+        Ref<VariableDeclStatement> *ref,
+        const ionshared::Ptr<Block> &scope
+    ) {
+        ionshared::OptPtr<VariableDeclStatement> value = ref->value;
+
+        if (ionshared::util::hasValue(value)) {
+            ionshared::OptPtr<VariableDeclStatement> copy = this->findCopy(value->get());
+
+            if (ionshared::util::hasValue(copy)) {
+                value = copy;
+            }
+        }
+        else {
+            auto binding = this->bindings.find(ref->name);
+
+            if (binding != this->bindings.end()) {
+                value = binding->second;
+            }
+        }
+
+        std::string name = ionshared::util::hasValue(value) ? value->get()->name : ref->name;
+
+        PtrRef<VariableDeclStatement> refCopy =
+            std::make_shared<Ref<VariableDeclStatement>>(name, scope, ref->refKind, value);
+
+        refCopy->sourceLocation = ref->sourceLocation;
+
+        return refCopy;
+    }
+
+    ConstructCloner::ConstructCloner(Renamer renamer) :
+        renamer(std::move(renamer)),
+        declarations(),
+        bindings() {
+        //
+    }
+
+    void ConstructCloner::bind(const std::string &name, ionshared::Ptr<VariableDeclStatement> variableDecl) {
+        this->bindings[name] = std::move(variableDecl);
+    }
+
+    ionshared::OptPtr<VariableDeclStatement> ConstructCloner::findCopy(
+        const VariableDeclStatement *variableDecl
+    ) const {
+        auto copy = this->declarations.find(variableDecl);
+
+        if (copy == this->declarations.end()) {
+            return std::nullopt;
+        }
+
+        return copy->second;
+    }
+
+    ionshared::Ptr<Construct> ConstructCloner::cloneValue(Construct *value, const ionshared::Ptr<Block> &scope) {
+        if (value == nullptr || value->constructKind != ConstructKind::Value) {
+            return nullptr;
+        }
+
+        ionshared::Ptr<Construct> copy;
+
+        switch (value->rawCast<Value<>>()->getValueKind()) {
+            case ValueKind::Integer: {
+                auto integerLiteral = value->rawCast<IntegerLiteral>();
+
+                copy = std::make_shared<IntegerLiteral>(integerLiteral->type, integerLiteral->value);
+
+                break;
+            }
+
+            case ValueKind::Boolean: {
+                BooleanLiteral *booleanLiteral = value->rawCast<BooleanLiteral>();
+
+                copy = std::make_shared<BooleanLiteral>(
+                    booleanLiteral->value,
+                    booleanLiteral->type->staticCast<BooleanType>()
+                );
+
+                break;
+            }
+
+            case ValueKind::Character: {
+                copy = std::make_shared<CharLiteral>(value->rawCast<CharLiteral>()->value);
+
+                break;
+            }
+
+            case ValueKind::String: {
+                copy = std::make_shared<StringLiteral>(value->rawCast<StringLiteral>()->value);
+
+                break;
+            }
+
+            case ValueKind::Expression: {
+                auto expression = value->rawCast<Expression>();
+
+                switch (expression->expressionKind) {
+                    case ExpressionKind::Call: {
+                        auto callExpr = value->rawCast<CallExpr>();
+                        CallArgs args = {};
+
+                        for (const auto &arg : callExpr->args) {
+                            ionshared::Ptr<Value<>> argCopy =
+                                util::tryCastValue(this->cloneValue(arg.get(), scope));
+
+                            if (argCopy == nullptr) {
+                                return nullptr;
+                            }
+
+                            args.push_back(argCopy);
+                        }
+
+                        // Functions are never copied, so the callee is kept.
+                        PtrRef<> calleeRef = std::make_shared<Ref<>>(
+                            callExpr->calleeRef->name,
+                            scope,
+                            callExpr->calleeRef->refKind,
+                            callExpr->calleeRef->value
+                        );
+
+                        calleeRef->sourceLocation = callExpr->calleeRef->sourceLocation;
+                        copy = std::make_shared<CallExpr>(calleeRef, args);
+
+                        break;
+                    }
+
+                    case ExpressionKind::UnaryOperation: {
+                        auto unaryOperation = value->rawCast<UnaryOperation>();
+
+                        ionshared::Ptr<Construct> operandCopy =
+                            this->cloneValue(unaryOperation->getValue().get(), scope);
+
+                        if (operandCopy == nullptr) {
+                            return nullptr;
+                        }
+
+                        copy = std::make_shared<UnaryOperation>(
+                            unaryOperation->type,
+                            unaryOperation->getOperator(),
+                            operandCopy
+                        );
+
+                        break;
+                    }
+
+                    case ExpressionKind::BinaryOperation: {
+                        auto binaryOperation = value->rawCast<BinaryOperation>();
+                        ionshared::OptPtr<Construct> rightSide = binaryOperation->getRightSide();
+                        ionshared::OptPtr<Construct> rightSideCopy = std::nullopt;
+
+                        ionshared::Ptr<Construct> leftSideCopy =
+                            this->cloneValue(binaryOperation->getLeftSide().get(), scope);
+
+                        if (leftSideCopy == nullptr) {
+                            return nullptr;
+                        }
+
+                        if (ionshared::util::hasValue(rightSide)) {
+                            rightSideCopy = this->cloneValue(rightSide->get(), scope);
+
+                            if (*rightSideCopy == nullptr) {
+                                return nullptr;
+                            }
+                        }
+
+                        copy = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+                            binaryOperation->type,
+                            binaryOperation->getOperator(),
+                            leftSideCopy,
+                            rightSideCopy
+                        });
+
+                        break;
+                    }
+
+                    case ExpressionKind::VariableRef: {
+                        auto variableRefExpr = value->rawCast<VariableRefExpr>();
+
+                        copy = std::make_shared<VariableRefExpr>(
+                            this->cloneVariableRef(variableRefExpr->getVariableDecl().get(), scope)
+                        );
+
+                        break;
+                    }
+
+                    default: {
+                        return nullptr;
+                    }
+                }
+
+                break;
+            }
+
+            default: {
+                return nullptr;
+            }
+        }
+
+        copy->sourceLocation = value->sourceLocation;
+
+        return copy;
+    }
+
+    ionshared::Ptr<Statement> ConstructCloner::cloneStatement(
+        Statement *statement,
+        const ionshared::Ptr<Block> &parent
+    ) {
+        ionshared::Ptr<Statement> copy;
+
+        switch (statement->statementKind) {
+            case StatementKind::VariableDeclaration: {
+                auto variableDecl = statement->rawCast<VariableDeclStatement>();
+
+                // The value is copied first, as it cannot refer to the declaration itself.
+                ionshared::Ptr<Construct> valueCopy = this->cloneValue(variableDecl->value.get(), parent);
+
+                if (valueCopy == nullptr) {
+                    return nullptr;
+                }
+
+                ionshared::Ptr<VariableDeclStatement> variableDeclCopy =
+                    std::make_shared<VariableDeclStatement>(VariableDeclStatementOpts{
+                        parent,
+                        variableDecl->type,
+                        this->renamer != nullptr ? this->renamer(variableDecl->name) : variableDecl->name,
+                        valueCopy
+                    });
+
+                this->declarations[variableDecl] = variableDeclCopy;
+                copy = variableDeclCopy;
+
+                break;
+            }
+
+            case StatementKind::Assignment: {
+                auto assignmentStatement = statement->rawCast<AssignmentStatement>();
+
+                ionshared::Ptr<Construct> valueCopy =
+                    this->cloneValue(assignmentStatement->value.get(), parent);
+
+                if (valueCopy == nullptr) {
+                    return nullptr;
+                }
+
+                copy = std::make_shared<AssignmentStatement>(AssignmentStatementOpts{
+                    parent,
+                    this->cloneVariableRef(assignmentStatement->variableDeclStatementRef.get(), parent),
+                    valueCopy
+                });
+
+                break;
+            }
+
+            case StatementKind::Return: {
+                auto returnStatement = statement->rawCast<ReturnStatement>();
+                ionshared::OptPtr<Expression> valueCopy = std::nullopt;
+
+                if (returnStatement->hasValue()) {
+                    valueCopy = util::tryCastValue<Expression>(
+                        this->cloneValue(returnStatement->value->get(), parent)
+                    );
+
+                    if (*valueCopy == nullptr) {
+                        return nullptr;
+                    }
+                }
+
+                copy = std::make_shared<ReturnStatement>(ReturnStatementOpts{
+                    parent,
+                    valueCopy
+                });
+
+                break;
+            }
+
+            case StatementKind::ExprWrapper: {
+                auto exprWrapperStatement = statement->rawCast<ExprWrapperStatement>();
+
+                ionshared::Ptr<Expression> expressionCopy = util::tryCastValue<Expression>(
+                    this->cloneValue(exprWrapperStatement->getExpression().get(), parent)
+                );
+
+                if (expressionCopy == nullptr) {
+                    return nullptr;
+                }
+
+                copy = std::make_shared<ExprWrapperStatement>(ExprWrapperStatementOpts{
+                    parent,
+                    expressionCopy
+                });
+
+                break;
+            }
+
+            case StatementKind::If: {
+                auto ifStatement = statement->rawCast<IfStatement>();
+
+                ionshared::Ptr<Construct> conditionCopy =
+                    this->cloneValue(ifStatement->condition.get(), parent);
+
+                if (conditionCopy == nullptr) {
+                    return nullptr;
+                }
+
+                // The parent of the blocks is filled in below.
+                ionshared::Ptr<Block> consequentBlockCopy =
+                    this->cloneBlock(ifStatement->consequentBlock.get(), nullptr);
+
+                ionshared::OptPtr<Block> alternativeBlockCopy = std::nullopt;
+
+                if (consequentBlockCopy == nullptr) {
+                    return nullptr;
+                }
+
+                if (ifStatement->hasAlternativeBlock()) {
+                    alternativeBlockCopy = this->cloneBlock(ifStatement->alternativeBlock->get(), nullptr);
+
+                    if (*alternativeBlockCopy == nullptr) {
+                        return nullptr;
+                    }
+                }
+
+                ionshared::Ptr<IfStatement> ifStatementCopy = std::make_shared<IfStatement>(IfStatementOpts{
+                    parent,
+                    conditionCopy,
+                    consequentBlockCopy,
+                    alternativeBlockCopy
+                });
+
+                consequentBlockCopy->parent = ifStatementCopy;
+
+                if (ionshared::util::hasValue(alternativeBlockCopy)) {
+                    alternativeBlockCopy->get()->parent = ifStatementCopy;
+                }
+
+                copy = ifStatementCopy;
+
+                break;
+            }
+
+            case StatementKind::BlockWrapper: {
+                ionshared::Ptr<Block> blockCopy =
+                    this->cloneBlock(statement->rawCast<BlockWrapperStatement>()->block.get(), nullptr);
+
+                if (blockCopy == nullptr) {
+                    return nullptr;
+                }
+
+                ionshared::Ptr<BlockWrapperStatement> blockWrapperCopy =
+                    std::make_shared<BlockWrapperStatement>(BlockWrapperStatementOpts{
+                        parent,
+                        blockCopy
+                    });
+
+                blockCopy->parent = blockWrapperCopy;
+                copy = blockWrapperCopy;
+
+                break;
+            }
+
+            default: {
+                return nullptr;
+            }
+        }
+
+        copy->sourceLocation = statement->sourceLocation;
+
+        return copy;
+    }
+
+    ionshared::Ptr<Block> ConstructCloner::cloneBlock(Block *block, const ionshared::Ptr<Construct> &parent) {
+        ionshared::Ptr<Block> blockCopy = std::make_shared<Block>(parent);
+
+        for (const auto &statement : block->statements) {
+            ionshared::Ptr<Statement> statementCopy = this->cloneStatement(statement.get(), blockCopy);
+
+            if (statementCopy == nullptr) {
+                return nullptr;
+            }
+
+            blockCopy->appendStatement(statementCopy);
+        }
+
+        blockCopy->sourceLocation = block->sourceLocation;
+
+        return blockCopy;
+    }
+}
@@ -7,13 +7,13 @@ namespace ionlang {
     }
 
     void IonIrEmittedEntities::set(
-        const ionshared::Ptr<Construct> &key,
+        const Construct *key,
         const ionshared::Ptr<ionir::Construct> &value
     ) {
         this->entities.set(key, value, true);
     }
 
-    bool IonIrEmittedEntities::contains(ionshared::Ptr<Construct> key) const {
-        return this->entities.contains(std::move(key));
+    bool IonIrEmittedEntities::contains(const Construct *key) const {
+        return this->entities.contains(key);
     }
 }
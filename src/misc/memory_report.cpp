@@ -0,0 +1,593 @@
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <ionlang/const/const.h>
+#include <ionlang/misc/memory_report.h>
+#include <ionlang/misc/util.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * The reference counts and deleter slot stored alongside each object
+     * allocated through std::make_shared().
+     */
+    static constexpr size_t sharedControlBlockBytes = sizeof(void *) + 2 * sizeof(int);
+
+    /**
+     * Estimate the memory held by an ionshared symbol table, assuming a
+     * node-based map underneath.
+     */
+    template<typename T>
+    static size_t estimateSymbolTableBytes(const ionshared::Ptr<ionshared::SymbolTable<T>> &symbolTable) {
+        if (symbolTable == nullptr) {
+            return 0;
+        }
+
+        size_t bytes = sizeof(ionshared::SymbolTable<T>) + sharedControlBlockBytes;
+
+        for (const auto &[key, value] : symbolTable->unwrap()) {
+            bytes += sizeof(std::pair<const std::string, T>) + 4 * sizeof(void *)
+                + util::getStringHeapBytes(key);
+        }
+
+        return bytes;
+    }
+
+    template<typename T>
+    static size_t getFlatSymbolTableBytes(const ionshared::Ptr<FlatSymbolTable<T>> &symbolTable) {
+        if (symbolTable == nullptr) {
+            return 0;
+        }
+
+        size_t bytes = sizeof(FlatSymbolTable<T>) + sharedControlBlockBytes + symbolTable->getHeapBytes();
+
+        symbolTable->forEach([&bytes](const std::string &key, const T &value) {
+            bytes += util::getStringHeapBytes(key);
+        });
+
+        return bytes;
+    }
+
+    static std::string getStatementKindName(StatementKind kind) {
+        switch (kind) {
+            case StatementKind::If: {
+                return "If";
+            }
+
+            case StatementKind::Return: {
+                return "Return";
+            }
+
+            case StatementKind::VariableDeclaration: {
+                return "VariableDeclaration";
+            }
+
+            case StatementKind::Assignment: {
+                return "Assignment";
+            }
+
+            case StatementKind::Call: {
+                return "Call";
+            }
+
+            case StatementKind::ExprWrapper: {
+                return "ExprWrapper";
+            }
+
+            case StatementKind::BlockWrapper: {
+                return "BlockWrapper";
+            }
+
+            default: {
+                return "Unknown";
+            }
+        }
+    }
+
+    static std::string getValueKindName(ValueKind kind) {
+        switch (kind) {
+            case ValueKind::Integer: {
+                return "Integer";
+            }
+
+            case ValueKind::Character: {
+                return "Character";
+            }
+
+            case ValueKind::String: {
+                return "String";
+            }
+
+            case ValueKind::Boolean: {
+                return "Boolean";
+            }
+
+            case ValueKind::Expression: {
+                return "Expression";
+            }
+
+            default: {
+                return "Unknown";
+            }
+        }
+    }
+
+    static std::string getExpressionKindName(ExpressionKind kind) {
+        switch (kind) {
+            case ExpressionKind::Call: {
+                return "Call";
+            }
+
+            case ExpressionKind::UnaryOperation: {
+                return "UnaryOperation";
+            }
+
+            case ExpressionKind::BinaryOperation: {
+                return "BinaryOperation";
+            }
+
+            case ExpressionKind::VariableRef: {
+                return "VariableRef";
+            }
+
+            default: {
+                return "Unknown";
+            }
+        }
+    }
+
+    static std::string getTypeKindName(TypeKind kind) {
+        switch (kind) {
+            case TypeKind::UserDefined: {
+                return "UserDefined";
+            }
+
+            case TypeKind::Void: {
+                return "Void";
+            }
+
+            case TypeKind::Integer: {
+                return "Integer";
+            }
+
+            case TypeKind::String: {
+                return "String";
+            }
+
+            case TypeKind::Boolean: {
+                return "Boolean";
+            }
+
+            default: {
+                return "Unknown";
+            }
+        }
+    }
+
+    /**
+     * Walks the tree, accounting each node once. The per-kind breakdowns
+     * of statements, values and expressions include the shared pointer
+     * overhead, so that they add up to their construct kind's total.
+     */
+    class MemoryAccountingPass : public Pass {
+    private:
+        MemoryReport &report;
+
+        std::unordered_set<const Construct *> visited;
+
+        std::unordered_set<const TypeQualifiers *> visitedQualifiers;
+
+        std::unordered_map<const Type *, size_t> typeReferenceCounts;
+
+        bool isRevisit;
+
+        void referenceType(Type *type) {
+            if (type == nullptr) {
+                return;
+            }
+
+            this->report.typeReferenceCount++;
+
+            // Account for the type object upon its first reference only.
+            if (this->typeReferenceCounts[type]++ != 0) {
+                return;
+            }
+
+            size_t bytes = sharedControlBlockBytes + util::getStringHeapBytes(type->name);
+
+            switch (type->typeKind) {
+                case TypeKind::Integer: {
+                    bytes += sizeof(IntegerType);
+
+                    break;
+                }
+
+                case TypeKind::Boolean: {
+                    bytes += sizeof(BooleanType);
+
+                    break;
+                }
+
+                case TypeKind::Void: {
+                    bytes += sizeof(VoidType);
+
+                    break;
+                }
+
+                default: {
+                    bytes += sizeof(Type);
+                }
+            }
+
+            const TypeQualifiers *qualifiers = type->getQualifiers();
+
+            if (qualifiers != nullptr && this->visitedQualifiers.insert(qualifiers).second) {
+                bytes += sizeof(TypeQualifiers) + sharedControlBlockBytes;
+            }
+
+            this->report.byTypeKind[type->typeKind].add(bytes);
+            this->report.byConstructKind[ConstructKind::Type].add(bytes);
+            this->report.total.add(bytes);
+        }
+
+        [[nodiscard]] size_t accountStatement(Statement *statement) {
+            size_t bytes;
+
+            switch (statement->statementKind) {
+                case StatementKind::If: {
+                    bytes = sizeof(IfStatement);
+
+                    break;
+                }
+
+                case StatementKind::Return: {
+                    bytes = sizeof(ReturnStatement);
+
+                    break;
+                }
+
+                case StatementKind::VariableDeclaration: {
+                    bytes = sizeof(VariableDeclStatement)
+                        + util::getStringHeapBytes(statement->rawCast<VariableDeclStatement>()->name);
+
+                    break;
+                }
+
+                case StatementKind::Assignment: {
+                    bytes = sizeof(AssignmentStatement);
+
+                    break;
+                }
+
+                case StatementKind::ExprWrapper: {
+                    bytes = sizeof(ExprWrapperStatement);
+
+                    break;
+                }
+
+                case StatementKind::BlockWrapper: {
+                    bytes = sizeof(BlockWrapperStatement);
+
+                    break;
+                }
+
+                default: {
+                    bytes = sizeof(Statement);
+                }
+            }
+
+            this->report.byStatementKind[statement->statementKind].add(bytes + sharedControlBlockBytes);
+
+            return bytes;
+        }
+
+        [[nodiscard]] size_t accountValue(Value<> *value) {
+            size_t bytes;
+
+            switch (value->kind) {
+                case ValueKind::Integer: {
+                    bytes = sizeof(IntegerLiteral);
+
+                    break;
+                }
+
+                case ValueKind::Character: {
+                    bytes = sizeof(CharLiteral);
+
+                    break;
+                }
+
+                case ValueKind::String: {
+                    bytes = sizeof(StringLiteral)
+                        + util::getStringHeapBytes(value->rawCast<StringLiteral>()->value);
+
+                    break;
+                }
+
+                case ValueKind::Boolean: {
+                    bytes = sizeof(BooleanLiteral);
+
+                    break;
+                }
+
+                case ValueKind::Expression: {
+                    bytes = this->accountExpression(value->rawCast<Expression>());
+
+                    break;
+                }
+
+                default: {
+                    bytes = sizeof(Value<>);
+                }
+            }
+
+            this->report.byValueKind[value->kind].add(bytes + sharedControlBlockBytes);
+
+            // Types of values are not among their children.
+            this->referenceType(value->type.get());
+
+            return bytes;
+        }
+
+        [[nodiscard]] size_t accountExpression(Expression *expression) {
+            size_t bytes;
+
+            switch (expression->expressionKind) {
+                case ExpressionKind::Call: {
+                    bytes = sizeof(CallExpr)
+                        + expression->rawCast<CallExpr>()->args.capacity() * sizeof(ionshared::Ptr<Value<>>);
+
+                    break;
+                }
+
+                case ExpressionKind::UnaryOperation: {
+                    bytes = sizeof(UnaryOperation);
+
+                    break;
+                }
+
+                case ExpressionKind::BinaryOperation: {
+                    bytes = sizeof(BinaryOperation);
+
+                    break;
+                }
+
+                case ExpressionKind::VariableRef: {
+                    bytes = sizeof(VariableRefExpr);
+
+                    break;
+                }
+
+                default: {
+                    bytes = sizeof(Expression);
+                }
+            }
+
+            this->report.byExpressionKind[expression->expressionKind].add(bytes + sharedControlBlockBytes);
+
+            return bytes;
+        }
+
+        [[nodiscard]] size_t accountPrototype(Prototype *prototype) {
+            size_t bytes = sizeof(Prototype) + util::getStringHeapBytes(prototype->name);
+
+            // Neither the return type nor the arguments are children.
+            this->referenceType(prototype->returnType.get());
+
+            if (prototype->args != nullptr) {
+                bytes += sizeof(Args) + sharedControlBlockBytes
+                    + getFlatSymbolTableBytes(prototype->args->items);
+
+                prototype->args->items->forEach([this, &bytes](const std::string &id, const Arg &arg) {
+                    bytes += util::getStringHeapBytes(arg.second);
+                    this->referenceType(arg.first.get());
+                });
+            }
+
+            return bytes;
+        }
+
+        void account(Construct *node) {
+            size_t bytes = sharedControlBlockBytes;
+
+            switch (node->constructKind) {
+                case ConstructKind::Module: {
+                    Module *module = node->rawCast<Module>();
+
+                    bytes += sizeof(Module)
+                        + util::getStringHeapBytes(module->name)
+                        + getFlatSymbolTableBytes(module->symbolTable);
+
+                    if (module->pendingRefs.has_value()) {
+                        bytes += module->pendingRefs->capacity() * sizeof(ionshared::Ptr<Construct>);
+                    }
+
+                    break;
+                }
+
+                case ConstructKind::Function: {
+                    bytes += sizeof(Function)
+                        + estimateSymbolTableBytes(node->rawCast<Function>()->localVariables);
+
+                    break;
+                }
+
+                case ConstructKind::Prototype: {
+                    bytes += this->accountPrototype(node->rawCast<Prototype>());
+
+                    break;
+                }
+
+                case ConstructKind::Extern: {
+                    bytes += sizeof(Extern);
+
+                    break;
+                }
+
+                case ConstructKind::Global: {
+                    bytes += sizeof(Global) + util::getStringHeapBytes(node->rawCast<Global>()->name);
+
+                    break;
+                }
+
+                case ConstructKind::Block: {
+                    Block *block = node->rawCast<Block>();
+
+                    bytes += sizeof(Block)
+                        + block->statements.capacity() * sizeof(ionshared::Ptr<Statement>)
+                        + getFlatSymbolTableBytes(block->symbolTable);
+
+                    break;
+                }
+
+                case ConstructKind::Struct: {
+                    Struct *structConstruct = node->rawCast<Struct>();
+
+                    bytes += sizeof(Struct)
+                        + util::getStringHeapBytes(structConstruct->name)
+                        + getFlatSymbolTableBytes(structConstruct->fields);
+
+                    break;
+                }
+
+                case ConstructKind::Attribute: {
+                    bytes += sizeof(Attribute) + util::getStringHeapBytes(node->rawCast<Attribute>()->name);
+
+                    break;
+                }
+
+                case ConstructKind::Ref: {
+                    bytes += sizeof(Ref<>) + util::getStringHeapBytes(node->rawCast<Ref<>>()->name);
+
+                    break;
+                }
+
+                case ConstructKind::Statement: {
+                    bytes += this->accountStatement(node->rawCast<Statement>());
+
+                    break;
+                }
+
+                case ConstructKind::Value: {
+                    bytes += this->accountValue(node->rawCast<Value<>>());
+
+                    break;
+                }
+
+                case ConstructKind::ErrorMarker: {
+                    bytes += sizeof(ErrorMarker);
+
+                    break;
+                }
+
+                default: {
+                    bytes += sizeof(Construct);
+                }
+            }
+
+            this->report.byConstructKind[node->constructKind].add(bytes);
+            this->report.total.add(bytes);
+        }
+
+    public:
+        explicit MemoryAccountingPass(MemoryReport &report) :
+            Pass(std::make_shared<ionshared::PassContext>()),
+            report(report),
+            visited(),
+            visitedQualifiers(),
+            typeReferenceCounts(),
+            isRevisit(false) {
+            //
+        }
+
+        void visitNode(Construct *node) override {
+            if (node->constructKind == ConstructKind::Type) {
+                this->isRevisit = true;
+                this->referenceType(node->rawCast<Type>());
+
+                return;
+            }
+
+            this->isRevisit = !this->visited.insert(node).second;
+
+            if (!this->isRevisit) {
+                this->account(node);
+            }
+        }
+
+        bool shouldVisitChildren(Construct *node) override {
+            // Types have no children, and shared nodes were walked already.
+            return !this->isRevisit;
+        }
+
+        void finish() {
+            for (const auto &[type, referenceCount] : this->typeReferenceCounts) {
+                if (referenceCount > 1) {
+                    this->report.sharedTypeCount++;
+                }
+                else {
+                    this->report.uniqueTypeCount++;
+                }
+            }
+        }
+    };
+
+    void MemoryUsage::add(size_t bytes) noexcept {
+        this->nodeCount++;
+        this->bytes += bytes;
+    }
+
+    MemoryReport MemoryReport::collect(const ionshared::Ptr<Construct> &root) {
+        MemoryReport report = MemoryReport();
+        MemoryAccountingPass memoryAccountingPass = MemoryAccountingPass(report);
+
+        memoryAccountingPass.visit(root);
+        memoryAccountingPass.finish();
+
+        return report;
+    }
+
+    std::string MemoryReport::format() const {
+        std::ostringstream result;
+
+        auto formatSection = [&result](const std::string &title, const auto &usages, const auto &getName) {
+            if (usages.empty()) {
+                return;
+            }
+
+            result << title << '\n';
+
+            for (const auto &[kind, usage] : usages) {
+                result << "  " << std::left << std::setw(24) << getName(kind)
+                    << std::right << std::setw(12) << usage.nodeCount
+                    << std::setw(16) << usage.bytes
+                    << '\n';
+            }
+        };
+
+        result << std::left << std::setw(26) << "Kind"
+            << std::right << std::setw(12) << "Nodes"
+            << std::setw(16) << "Bytes"
+            << '\n';
+
+        formatSection("Constructs", this->byConstructKind, [](ConstructKind kind) {
+            return Const::getConstructKindName(kind).value_or("Unknown");
+        });
+
+        formatSection("Statements", this->byStatementKind, getStatementKindName);
+        formatSection("Values", this->byValueKind, getValueKindName);
+        formatSection("Expressions", this->byExpressionKind, getExpressionKindName);
+        formatSection("Types", this->byTypeKind, getTypeKindName);
+
+        result << std::left << std::setw(26) << "Total"
+            << std::right << std::setw(12) << this->total.nodeCount
+            << std::setw(16) << this->total.bytes
+            << '\n'
+            << "Type references: " << this->typeReferenceCount
+            << " (shared type objects: " << this->sharedTypeCount
+            << ", unique type objects: " << this->uniqueTypeCount << ")\n";
+
+        return result.str();
+    }
+}
@@ -0,0 +1,307 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <ionlang/misc/profiler.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace ionlang {
+    /**
+     * Escape a string for use within a JSON string literal.
+     */
+    static std::string escapeJson(std::string_view value) {
+        std::ostringstream result;
+
+        for (char character : value) {
+            switch (character) {
+                case '"': {
+                    result << "\\\"";
+
+                    break;
+                }
+
+                case '\\': {
+                    result << "\\\\";
+
+                    break;
+                }
+
+                case '\n': {
+                    result << "\\n";
+
+                    break;
+                }
+
+                default: {
+                    if (static_cast<unsigned char>(character) < 0x20) {
+                        result << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                            << static_cast<int>(character) << std::dec;
+                    }
+                    else {
+                        result << character;
+                    }
+                }
+            }
+        }
+
+        return result.str();
+    }
+
+    Profiler &Profiler::getDefault() {
+        // Profiling may be enabled up front, without any code changes.
+        static Profiler profiler =
+            Profiler(std::getenv(Profiler::environmentVariable) != nullptr);
+
+        return profiler;
+    }
+
+    uint64_t Profiler::readCpuMicroseconds() {
+#ifdef _WIN32
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+
+        if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+            return 0;
+        }
+
+        auto toMicroseconds = [](const FILETIME &time) {
+            // File times are expressed in 100 nanosecond intervals.
+            return ((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 10;
+        };
+
+        return toMicroseconds(kernelTime) + toMicroseconds(userTime);
+#else
+        rusage usage{};
+
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+
+        auto toMicroseconds = [](const timeval &time) {
+            return static_cast<uint64_t>(time.tv_sec) * 1000000 + static_cast<uint64_t>(time.tv_usec);
+        };
+
+        return toMicroseconds(usage.ru_utime) + toMicroseconds(usage.ru_stime);
+#endif
+    }
+
+    uint64_t Profiler::readPeakMemoryBytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return 0;
+        }
+
+        return counters.PeakWorkingSetSize;
+#else
+        rusage usage{};
+
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+
+#ifdef __APPLE__
+        // Reported in bytes on macOS.
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        // Reported in kilobytes elsewhere.
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+
+    Profiler::Profiler(bool isEnabled) :
+        isEnabled(isEnabled),
+        epoch(std::chrono::steady_clock::now()),
+        mutex(),
+        events() {
+        //
+    }
+
+    void Profiler::setIsEnabled(bool isEnabled) noexcept {
+        this->isEnabled.store(isEnabled, std::memory_order_relaxed);
+    }
+
+    uint64_t Profiler::getElapsedMicroseconds() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - this->epoch
+        ).count();
+    }
+
+    void Profiler::record(ProfileEvent event) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->events.push_back(std::move(event));
+    }
+
+    std::vector<ProfileEvent> Profiler::getEvents() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        return this->events;
+    }
+
+    void Profiler::clear() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->events.clear();
+    }
+
+    std::string Profiler::formatTable() const {
+        struct Row {
+            std::string category;
+
+            uint64_t count = 0;
+
+            uint64_t wallMicroseconds = 0;
+
+            uint64_t cpuMicroseconds = 0;
+
+            uint64_t nodeCount = 0;
+
+            uint64_t peakMemoryGrowthBytes = 0;
+        };
+
+        std::vector<ProfileEvent> events = this->getEvents();
+
+        // Keep the rows in order of first appearance.
+        std::vector<std::string> names = {};
+        std::map<std::string, Row> rows = {};
+
+        for (const auto &event : events) {
+            auto [row, isNew] = rows.try_emplace(event.name);
+
+            if (isNew) {
+                names.push_back(event.name);
+                row->second.category = event.category;
+            }
+
+            row->second.count++;
+            row->second.wallMicroseconds += event.wallMicroseconds;
+            row->second.cpuMicroseconds += event.cpuMicroseconds;
+            row->second.nodeCount += event.nodeCount;
+            row->second.peakMemoryGrowthBytes += event.peakMemoryGrowthBytes;
+        }
+
+        size_t nameWidth = 4;
+
+        for (const auto &name : names) {
+            nameWidth = std::max(nameWidth, name.size());
+        }
+
+        std::ostringstream table;
+
+        table << std::left << std::setw(static_cast<int>(nameWidth)) << "Name"
+            << std::right
+            << std::setw(10) << "Category"
+            << std::setw(8) << "Count"
+            << std::setw(12) << "Wall (ms)"
+            << std::setw(12) << "CPU (ms)"
+            << std::setw(12) << "Nodes"
+            << std::setw(18) << "Peak Growth (KiB)"
+            << '\n';
+
+        table << std::fixed << std::setprecision(3);
+
+        for (const auto &name : names) {
+            const Row &row = rows.at(name);
+
+            table << std::left << std::setw(static_cast<int>(nameWidth)) << name
+                << std::right
+                << std::setw(10) << row.category
+                << std::setw(8) << row.count
+                << std::setw(12) << row.wallMicroseconds / 1000.0
+                << std::setw(12) << row.cpuMicroseconds / 1000.0
+                << std::setw(12) << row.nodeCount
+                << std::setw(18) << row.peakMemoryGrowthBytes / 1024
+                << '\n';
+        }
+
+        return table.str();
+    }
+
+    std::string Profiler::formatChromeTrace() const {
+        std::vector<ProfileEvent> events = this->getEvents();
+        std::map<std::thread::id, size_t> threadIndices = {};
+        std::ostringstream trace;
+
+        trace << "{\"traceEvents\":[";
+
+        for (size_t i = 0; i < events.size(); i++) {
+            const ProfileEvent &event = events[i];
+
+            // Thread ids are opaque, number them in order of appearance.
+            size_t threadIndex =
+                threadIndices.try_emplace(event.threadId, threadIndices.size()).first->second;
+
+            if (i != 0) {
+                trace << ',';
+            }
+
+            trace << "{\"name\":\"" << escapeJson(event.name)
+                << "\",\"cat\":\"" << escapeJson(event.category)
+                << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadIndex
+                << ",\"ts\":" << event.startMicroseconds
+                << ",\"dur\":" << event.wallMicroseconds
+                << ",\"args\":{\"cpuMicroseconds\":" << event.cpuMicroseconds
+                << ",\"nodeCount\":" << event.nodeCount
+                << ",\"peakMemoryGrowthBytes\":" << event.peakMemoryGrowthBytes
+                << "}}";
+        }
+
+        trace << "],\"displayTimeUnit\":\"ms\"}";
+
+        return trace.str();
+    }
+
+    ProfileScope::ProfileScope(
+        std::string_view name,
+        std::string_view category,
+        Profiler &profiler
+    ) :
+        profiler(profiler),
+        isActive(profiler.getIsEnabled()),
+        name(),
+        category(),
+        startMicroseconds(0),
+        startCpuMicroseconds(0),
+        startPeakMemoryBytes(0),
+        nodeCount(0) {
+        if (!this->isActive) {
+            return;
+        }
+
+        this->name = name;
+        this->category = category;
+        this->startMicroseconds = profiler.getElapsedMicroseconds();
+        this->startCpuMicroseconds = Profiler::readCpuMicroseconds();
+        this->startPeakMemoryBytes = Profiler::readPeakMemoryBytes();
+    }
+
+    ProfileScope::~ProfileScope() {
+        if (!this->isActive) {
+            return;
+        }
+
+        uint64_t endMicroseconds = this->profiler.getElapsedMicroseconds();
+        uint64_t endCpuMicroseconds = Profiler::readCpuMicroseconds();
+        uint64_t endPeakMemoryBytes = Profiler::readPeakMemoryBytes();
+
+        this->profiler.record(ProfileEvent{
+            std::move(this->name),
+            std::move(this->category),
+            std::this_thread::get_id(),
+            this->startMicroseconds,
+            endMicroseconds - this->startMicroseconds,
+            endCpuMicroseconds - std::min(endCpuMicroseconds, this->startCpuMicroseconds),
+            this->nodeCount,
+            endPeakMemoryBytes - std::min(endPeakMemoryBytes, this->startPeakMemoryBytes)
+        });
+    }
+}
@@ -160,4 +160,37 @@ namespace ionlang::util {
             }
         }
     }
+
+    size_t getStringHeapBytes(const std::string &value) noexcept {
+        const char *data = value.data();
+        const auto *object = reinterpret_cast<const char *>(&value);
+
+        if (data >= object && data < object + sizeof(std::string)) {
+            return 0;
+        }
+
+        return value.capacity() + 1;
+    }
+
+    bool hasCall(Construct *value) {
+        std::vector<Construct *> stack = {value};
+
+        while (!stack.empty()) {
+            Construct *construct = stack.back();
+
+            stack.pop_back();
+
+            if (construct->constructKind == ConstructKind::Value
+                && construct->rawCast<Value<>>()->getValueKind() == ValueKind::Expression
+                && construct->rawCast<Expression>()->expressionKind == ExpressionKind::Call) {
+                return true;
+            }
+
+            construct->forEachChild([&stack](Construct *child) {
+                stack.push_back(child);
+            });
+        }
+
+        return false;
+    }
 }
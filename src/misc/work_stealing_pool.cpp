@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <ionlang/misc/work_stealing_pool.h>
+
+namespace ionlang {
+    WorkStealingPool::WorkStealingPool(size_t workerCount) :
+        queues(),
+        threads(),
+        mutex(),
+        wakeCondition(),
+        doneCondition(),
+        job(nullptr),
+        generation(0),
+        activeWorkers(0),
+        isStopping(false),
+        pendingTasks(0),
+        firstException() {
+        if (workerCount == 0) {
+            // The hardware concurrency may be reported as zero if unknown.
+            workerCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+        for (size_t i = 0; i < workerCount; i++) {
+            this->queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        // The first worker is the thread invoking run().
+        for (size_t workerIndex = 1; workerIndex < workerCount; workerIndex++) {
+            this->threads.emplace_back(&WorkStealingPool::workerMain, this, workerIndex);
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            this->isStopping = true;
+        }
+
+        this->wakeCondition.notify_all();
+
+        for (auto &thread : this->threads) {
+            thread.join();
+        }
+    }
+
+    std::optional<size_t> WorkStealingPool::takeTask(size_t workerIndex) {
+        {
+            WorkerQueue &ownQueue = *this->queues[workerIndex];
+            std::lock_guard<std::mutex> lock(ownQueue.mutex);
+
+            if (!ownQueue.tasks.empty()) {
+                size_t taskIndex = ownQueue.tasks.back();
+
+                ownQueue.tasks.pop_back();
+
+                return taskIndex;
+            }
+        }
+
+        // Steal from the other workers, starting with the next one.
+        size_t workerCount = this->queues.size();
+
+        for (size_t offset = 1; offset < workerCount; offset++) {
+            WorkerQueue &victimQueue = *this->queues[(workerIndex + offset) % workerCount];
+            std::lock_guard<std::mutex> lock(victimQueue.mutex);
+
+            if (!victimQueue.tasks.empty()) {
+                size_t taskIndex = victimQueue.tasks.front();
+
+                victimQueue.tasks.pop_front();
+
+                return taskIndex;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void WorkStealingPool::drain(size_t workerIndex, const Job &job) {
+        /**
+         * All tasks of a batch are queued before the workers are woken
+         * up, therefore once no task can be taken, none will appear.
+         */
+        for (std::optional<size_t> taskIndex = this->takeTask(workerIndex);
+            taskIndex.has_value();
+            taskIndex = this->takeTask(workerIndex)
+        ) {
+            try {
+                job(workerIndex, *taskIndex);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+
+                if (this->firstException == nullptr) {
+                    this->firstException = std::current_exception();
+                }
+            }
+
+            this->pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    void WorkStealingPool::workerMain(size_t workerIndex) {
+        size_t lastGeneration = 0;
+
+        while (true) {
+            const Job *currentJob;
+
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+
+                /**
+                 * The job is cleared once a batch completes, so that workers
+                 * waking up late never pick up a stale job.
+                 */
+                this->wakeCondition.wait(lock, [&] {
+                    return this->isStopping
+                        || (this->job != nullptr && this->generation != lastGeneration);
+                });
+
+                if (this->isStopping) {
+                    return;
+                }
+
+                lastGeneration = this->generation;
+                currentJob = this->job;
+                this->activeWorkers++;
+            }
+
+            this->drain(workerIndex, *currentJob);
+
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+
+                this->activeWorkers--;
+            }
+
+            this->doneCondition.notify_all();
+        }
+    }
+
+    size_t WorkStealingPool::getWorkerCount() const noexcept {
+        return this->queues.size();
+    }
+
+    void WorkStealingPool::run(size_t taskCount, const Job &job) {
+        if (taskCount == 0) {
+            return;
+        }
+
+        size_t workerCount = this->queues.size();
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            // Deal the tasks out evenly; stealing balances uneven tasks.
+            for (size_t taskIndex = 0; taskIndex < taskCount; taskIndex++) {
+                WorkerQueue &queue = *this->queues[taskIndex % workerCount];
+                std::lock_guard<std::mutex> queueLock(queue.mutex);
+
+                queue.tasks.push_back(taskIndex);
+            }
+
+            this->pendingTasks.store(taskCount, std::memory_order_release);
+            this->firstException = nullptr;
+            this->job = &job;
+            this->generation++;
+        }
+
+        this->wakeCondition.notify_all();
+        this->drain(0, job);
+
+        std::exception_ptr exception;
+
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+
+            this->doneCondition.wait(lock, [this] {
+                return this->activeWorkers == 0
+                    && this->pendingTasks.load(std::memory_order_acquire) == 0;
+            });
+
+            this->job = nullptr;
+            exception = this->firstException;
+            this->firstException = nullptr;
+        }
+
+        if (exception != nullptr) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
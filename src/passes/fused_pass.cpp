@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <stdexcept>
+#include <ionlang/passes/fused_pass.h>
+#include <ionlang/passes/rewrite_pass.h>
+
+namespace ionlang {
+    bool FusedPass::canFuse(const std::vector<ionshared::Ptr<Pass>> &passes, const Pass &pass) {
+        if (!pass.isFusible()) {
+            return false;
+        }
+        else if (!passes.empty() && passes.front()->passScope != pass.passScope) {
+            return false;
+        }
+        else if (dynamic_cast<const RewritePass *>(&pass) == nullptr) {
+            return true;
+        }
+
+        return std::none_of(passes.begin(), passes.end(), [](const ionshared::Ptr<Pass> &otherPass) {
+            return dynamic_cast<const RewritePass *>(otherPass.get()) != nullptr;
+        });
+    }
+
+    FusedPass::FusedPass(std::vector<ionshared::Ptr<Pass>> passes) :
+        Pass(
+            passes.empty() ? nullptr : passes.front()->context,
+            passes.empty() ? PassScope::Module : passes.front()->passScope
+        ),
+
+        passes(std::move(passes)),
+        name("FusedPass("),
+        suppressedDepths(this->passes.size(), 0),
+        depth(0) {
+        std::vector<ionshared::Ptr<Pass>> precedingPasses = {};
+
+        for (const auto &pass : this->passes) {
+            if (pass != this->passes.front()) {
+                this->name += ", ";
+            }
+
+            this->name += pass->getPassName();
+
+            if (!pass->isFusible()) {
+                // TODO: Use diagnostics.
+                throw std::invalid_argument("Pass cannot be fused");
+            }
+            else if (pass->passScope != this->passScope) {
+                throw std::invalid_argument("Fused passes must have the same scope");
+            }
+            else if (!FusedPass::canFuse(precedingPasses, *pass)) {
+                throw std::invalid_argument("At most one rewrite pass may be fused");
+            }
+
+            precedingPasses.push_back(pass);
+        }
+
+        this->name += ")";
+    }
+
+    const std::vector<ionshared::Ptr<Pass>> &FusedPass::getPasses() const noexcept {
+        return this->passes;
+    }
+
+    ionshared::Ptr<Pass> FusedPass::clone() const {
+        std::vector<ionshared::Ptr<Pass>> clones = {};
+
+        clones.reserve(this->passes.size());
+
+        for (const auto &pass : this->passes) {
+            ionshared::Ptr<Pass> clone = pass->clone();
+
+            clone->analysisManager = pass->analysisManager;
+            clones.push_back(std::move(clone));
+        }
+
+        ionshared::Ptr<FusedPass> fusedPass = std::make_shared<FusedPass>(std::move(clones));
+
+        fusedPass->analysisManager = this->analysisManager;
+
+        return fusedPass;
+    }
+
+    void FusedPass::mergeStatistics(const Pass &clone) {
+        const auto &other = static_cast<const FusedPass &>(clone);
+
+        Pass::mergeStatistics(clone);
+
+        for (size_t i = 0; i < this->passes.size(); i++) {
+            this->passes[i]->mergeStatistics(*other.passes[i]);
+        }
+    }
+
+    std::string_view FusedPass::getPassName() const {
+        return this->name;
+    }
+
+    void FusedPass::resetTraversalState() {
+        std::fill(this->suppressedDepths.begin(), this->suppressedDepths.end(), 0);
+        this->depth = 0;
+
+        for (const auto &pass : this->passes) {
+            pass->resetTraversalState();
+        }
+    }
+
+    void FusedPass::visitNode(Construct *node) {
+        this->depth++;
+
+        for (size_t i = 0; i < this->passes.size(); i++) {
+            if (this->suppressedDepths[i] == 0) {
+                this->passes[i]->visitNode(node);
+            }
+        }
+    }
+
+    bool FusedPass::shouldVisitChildren(Construct *node) {
+        bool isAnyPassActive = false;
+
+        for (size_t i = 0; i < this->passes.size(); i++) {
+            if (this->suppressedDepths[i] != 0) {
+                continue;
+            }
+            else if (!this->passes[i]->shouldVisitChildren(node)) {
+                this->suppressedDepths[i] = this->depth;
+
+                continue;
+            }
+
+            isAnyPassActive = true;
+        }
+
+        return isAnyPassActive;
+    }
+
+    void FusedPass::afterVisitChildren(Construct *node) {
+        for (size_t i = 0; i < this->passes.size(); i++) {
+            /**
+             * A pass which declined this node's children is reactivated,
+             * once it was notified about leaving the node. From its point
+             * of view, the node's children were merely skipped.
+             */
+            if (this->suppressedDepths[i] == this->depth) {
+                this->suppressedDepths[i] = 0;
+            }
+            else if (this->suppressedDepths[i] != 0) {
+                continue;
+            }
+
+            this->passes[i]->afterVisitChildren(node);
+        }
+
+        this->depth--;
+    }
+}
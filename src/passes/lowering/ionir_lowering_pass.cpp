@@ -10,6 +10,7 @@
 #include <ionir/construct/struct.h>
 #include <ionir/misc/inst_builder.h>
 #include <ionir/const/const.h>
+#include <ionlang/analysis/reachability_analysis.h>
 #include <ionlang/passes/lowering/ionir_lowering_pass.h>
 #include <ionlang/const/notice.h>
 #include <ionlang/const/const.h>
@@ -17,14 +18,21 @@
 namespace ionlang {
     ionshared::Ptr<ionir::Type> IonIrLoweringPass::processTypeQualifiers(
         ionshared::Ptr<ionir::Type> type,
-        const ionshared::Ptr<TypeQualifiers> &qualifiers
+        const Type *qualifiedType
     ) {
         ionshared::Ptr<ionir::TypeQualifiers> ionIrTypeQualifiers =
             std::make_shared<ionir::TypeQualifiers>();
 
-        auto typeQualifiersSet = qualifiers->unwrap();
+        for (const TypeQualifier typeQualifier : {
+            TypeQualifier::Constant,
+            TypeQualifier::Mutable,
+            TypeQualifier::Reference,
+            TypeQualifier::Pointer
+        }) {
+            if (!qualifiedType->hasQualifier(typeQualifier)) {
+                continue;
+            }
 
-        for (const auto &typeQualifier : typeQualifiersSet) {
             ionir::TypeQualifier ionIrTypeQualifier;
 
             switch (typeQualifier) {
@@ -111,6 +119,29 @@ namespace ionlang {
         this->buffers = buffersBackup;
     }
 
+    bool IonIrLoweringPass::pushCachedType(const Type *type) {
+        auto cachedType = this->typeCache.find(type);
+
+        if (cachedType == this->typeCache.end()) {
+            return false;
+        }
+
+        this->typeStack.push(cachedType->second.ionIrType);
+
+        return true;
+    }
+
+    void IonIrLoweringPass::pushType(Type *type, ionshared::Ptr<ionir::Type> ionIrType) {
+        if (type->isInterned) {
+            this->typeCache[type] = CachedType{
+                type->staticCast<Type>(),
+                ionIrType
+            };
+        }
+
+        this->typeStack.push(std::move(ionIrType));
+    }
+
     uint32_t IonIrLoweringPass::getNameCounter() noexcept {
         return this->nameCounter++;
     }
@@ -125,13 +156,20 @@ namespace ionlang {
         typeStack(),
         buffers(),
         symbolTable(),
-        nameCounter(0) {
+        typeCache(),
+        nameCounter(0),
+        mode(LoweringMode::Eager),
+        rootNames() {
         //
     }
 
     // TODO
     IonIrLoweringPass::~IonIrLoweringPass() = default;
 
+    std::string_view IonIrLoweringPass::getPassName() const {
+        return "IonIrLoweringPass";
+    }
+
     ionshared::Stack<ionshared::Ptr<ionir::Construct>> IonIrLoweringPass::getConstructStack() const noexcept {
         return this->constructStack;
     }
@@ -158,16 +196,31 @@ namespace ionlang {
         return false;
     }
 
+    LoweringMode IonIrLoweringPass::getMode() const noexcept {
+        return this->mode;
+    }
+
+    void IonIrLoweringPass::setMode(LoweringMode mode) noexcept {
+        this->mode = mode;
+    }
+
+    void IonIrLoweringPass::addRoot(std::string name) {
+        this->rootNames.push_back(std::move(name));
+    }
+
     void IonIrLoweringPass::visit(ionshared::Ptr<Construct> node) {
         /**
-         * Only instruct the node to visit this instance and
-         * not its children, since they're already visited by
-         * the other member methods.
+         * Only dispatch the node itself and not its children,
+         * since they're already visited by the other member
+         * methods.
          */
-        node->accept(*this);
+        this->visitNode(node.get());
     }
 
-    void IonIrLoweringPass::visitModule(ionshared::Ptr<Module> node) {
+    void IonIrLoweringPass::visitModule(Module *node) {
+        // Lowered types belong to the previous IonIR module.
+        this->typeCache.clear();
+
         this->buffers.module = std::make_shared<ionir::Module>(
             std::make_shared<ionir::Identifier>(node->name)
         );
@@ -175,11 +228,26 @@ namespace ionlang {
         // Set the module on the modules symbol table.
         this->modules->set(node->name, *this->buffers.module);
 
+        std::shared_ptr<const ReachabilityAnalysis::Result> reachable = nullptr;
+
+        if (this->mode == LoweringMode::Reachable) {
+            // Additional roots are specific to this pass, and thus not cached.
+            reachable = this->rootNames.empty()
+                ? this->requireAnalysisManager()->get<ReachabilityAnalysis>(node)
+                : std::make_shared<const ReachabilityAnalysis::Result>(
+                    ReachabilityAnalysis::collect(node, this->rootNames)
+                );
+        }
+
         // Proceed to visit all the module's children (top-level constructs).
-        std::map<std::string, ionshared::Ptr<Construct>> moduleSymbolTable =
-            node->context->getGlobalScope()->unwrap();
+        node->symbolTable->forEach([this, &reachable](const std::string &id, const ionshared::Ptr<Construct> &topLevelConstruct) {
+            // Skip unreachable functions, externs and globals. Structs are always lowered.
+            if (reachable != nullptr
+                && ReachabilityAnalysis::isTracked(topLevelConstruct.get())
+                && reachable->count(topLevelConstruct.get()) == 0) {
+                return;
+            }
 
-        for (const auto &[id, topLevelConstruct] : moduleSymbolTable) {
             this->visit(topLevelConstruct);
 
             /**
@@ -187,10 +255,10 @@ namespace ionlang {
              * global variables) as they have no use elsewhere.
              */
             this->constructStack.tryPop();
-        }
+        });
     }
 
-    void IonIrLoweringPass::visitFunction(ionshared::Ptr<Function> node) {
+    void IonIrLoweringPass::visitFunction(Function *node) {
         if (this->symbolTable.contains(node)) {
             return;
         }
@@ -214,7 +282,7 @@ namespace ionlang {
             );
         }
 
-        this->visitPrototype(node->prototype);
+        this->visitPrototype(node->prototype.get());
 
         ionshared::Ptr<ionir::Prototype> ionIrPrototype =
             this->constructStack.pop()->dynamicCast<ionir::Prototype>();
@@ -231,7 +299,7 @@ namespace ionlang {
         // Set the function buffer. This is required when visiting the function body.
         this->buffers.function = ionIrFunction;
 
-        this->visitBlock(node->body);
+        this->visitBlock(node->body.get());
 
         // TODO: Redundant Repetitive assignment?
         // Set the function buffer.
@@ -250,7 +318,7 @@ namespace ionlang {
         this->constructStack.push(ionIrFunction);
     }
 
-    void IonIrLoweringPass::visitExtern(ionshared::Ptr<Extern> node) {
+    void IonIrLoweringPass::visitExtern(Extern *node) {
         if (this->symbolTable.contains(node)) {
             return;
         }
@@ -271,7 +339,7 @@ namespace ionlang {
             throw std::runtime_error("Entity with same id already exists on module");
         }
 
-        this->visitPrototype(prototype);
+        this->visitPrototype(prototype.get());
 
         ionshared::Ptr<ionir::Prototype> ionIrPrototype =
             this->constructStack.pop()->dynamicCast<ionir::Prototype>();
@@ -289,26 +357,25 @@ namespace ionlang {
         this->constructStack.push(ionIrExtern);
     }
 
-    void IonIrLoweringPass::visitPrototype(ionshared::Ptr<Prototype> node) {
+    void IonIrLoweringPass::visitPrototype(Prototype *node) {
         this->requireModule();
-        this->visitType(node->returnType);
+        this->visitType(node->returnType.get());
 
         ionshared::Ptr<ionir::Type> ionIrReturnType = this->typeStack.pop();
         ionshared::Ptr<ionir::Args> ionIrArguments = std::make_shared<ionir::Args>();
         ionshared::Ptr<Args> arguments = node->args;
-        auto nativeArguments = arguments->items->unwrap();
 
         ionIrArguments->setIsVariable(arguments->isVariable);
 
         // TODO: Should Args be a construct, and be visited?
-        for (const auto &[id, argument] : nativeArguments) {
-            this->visitType(argument.first);
+        arguments->items->forEach([this, &ionIrArguments](const std::string &id, const Arg &argument) {
+            this->visitType(argument.first.get());
 
             ionIrArguments->getItems()->set(
                 argument.second,
                 std::make_pair(this->typeStack.pop(), argument.second)
             );
-        }
+        });
 
         ionshared::Ptr<ionir::Prototype> ionIrPrototype = std::make_shared<ionir::Prototype>(
             node->name,
@@ -320,7 +387,7 @@ namespace ionlang {
         this->constructStack.push(ionIrPrototype);
     }
 
-    void IonIrLoweringPass::visitBlock(ionshared::Ptr<Block> node) {
+    void IonIrLoweringPass::visitBlock(Block *node) {
         ionshared::Ptr<ionir::Function> ionIrFunctionBuffer = this->requireFunction();
         ionshared::OptPtr<ionir::FunctionBody> ionIrFunctionBody = std::nullopt;
         ionir::BasicBlockKind ionIrBasicBlockKind = ionir::BasicBlockKind::Internal;
@@ -365,7 +432,7 @@ namespace ionlang {
 
         for (const auto &statement : statements) {
             // Visit the statement.
-            this->visitStatement(statement);
+            this->visitStatement(statement.get());
 
             // TODO: IMPORTANT: DO note that (some?) visitStatements, (ex. visitReturnStatement) already register insts via builder. (They use buffered builder, which is set on code above and bound to the buffered block, set above).
             // TODO: Insts and registers must be popped off and added onto the block.
@@ -395,14 +462,14 @@ namespace ionlang {
         }
     }
 
-    void IonIrLoweringPass::visitIntegerLiteral(ionshared::Ptr<IntegerLiteral> node) {
+    void IonIrLoweringPass::visitIntegerLiteral(IntegerLiteral *node) {
         ionshared::Ptr<Type> nodeType = node->getType();
 
         if (nodeType->getTypeKind() != TypeKind::Integer) {
             throw std::runtime_error("Integer value's type must be integer type");
         }
 
-        this->visitIntegerType(nodeType->dynamicCast<IntegerType>());
+        this->visitIntegerType(nodeType->rawCast<IntegerType>());
 
         ionshared::Ptr<ionir::IntegerType> ionIrIntegerType =
             this->typeStack.pop()->dynamicCast<ionir::IntegerType>();
@@ -414,32 +481,32 @@ namespace ionlang {
         this->constructStack.push(ionIrIntegerLiteral->staticCast<ionir::Value<>>());
     }
 
-    void IonIrLoweringPass::visitCharLiteral(ionshared::Ptr<CharLiteral> node) {
+    void IonIrLoweringPass::visitCharLiteral(CharLiteral *node) {
         ionshared::Ptr<ionir::CharLiteral> ionIrCharLiteral =
             std::make_shared<ionir::CharLiteral>(node->value);
 
         this->constructStack.push(ionIrCharLiteral->dynamicCast<ionir::Value<>>());
     }
 
-    void IonIrLoweringPass::visitStringLiteral(ionshared::Ptr<StringLiteral> node) {
+    void IonIrLoweringPass::visitStringLiteral(StringLiteral *node) {
         ionshared::Ptr<ionir::StringLiteral> ionIrStringLiteral =
             std::make_shared<ionir::StringLiteral>(node->value);
 
         this->constructStack.push(ionIrStringLiteral->dynamicCast<ionir::Value<>>());
     }
 
-    void IonIrLoweringPass::visitBooleanLiteral(ionshared::Ptr<BooleanLiteral> node) {
+    void IonIrLoweringPass::visitBooleanLiteral(BooleanLiteral *node) {
         ionshared::Ptr<ionir::BooleanLiteral> ionIrBooleanLiteral =
             std::make_shared<ionir::BooleanLiteral>(node->value);
 
         this->constructStack.push(ionIrBooleanLiteral->dynamicCast<ionir::Value<>>());
     }
 
-    void IonIrLoweringPass::visitGlobal(ionshared::Ptr<Global> node) {
+    void IonIrLoweringPass::visitGlobal(Global *node) {
         // Module buffer will be used, therefore it must be set.
         ionshared::Ptr<ionir::Module> ionIrModuleBuffer = this->requireModule();
 
-        this->visitType(node->type);
+        this->visitType(node->type.get());
 
         ionshared::Ptr<ionir::Type> type = this->typeStack.pop();
         ionshared::OptPtr<Value<>> nodeValue = node->value;
@@ -447,7 +514,7 @@ namespace ionlang {
 
         // Assign value if applicable.
         if (ionshared::util::hasValue(nodeValue)) {
-            Pass::visitValue(*nodeValue);
+            Pass::visitValue(nodeValue->get());
 
             // Use static pointer cast when downcasting to ionir::Value<>.
             value = this->constructStack.pop()->staticCast<ionir::Value<>>();
@@ -476,7 +543,7 @@ namespace ionlang {
         this->constructStack.push(ionIrGlobalVariable);
     }
 
-    void IonIrLoweringPass::visitType(ionshared::Ptr<Type> node) {
+    void IonIrLoweringPass::visitType(Type *node) {
         // Convert type to a pointer if applicable.
         // TODO: Now it's PointerType (soon to be implemented or already).
         //        if (node->getIsPointer()) {
@@ -488,15 +555,15 @@ namespace ionlang {
 
         switch (node->getTypeKind()) {
             case TypeKind::Void: {
-                return this->visitVoidType(node->staticCast<VoidType>());
+                return this->visitVoidType(node->rawCast<VoidType>());
             }
 
             case TypeKind::Integer: {
-                return this->visitIntegerType(node->staticCast<IntegerType>());
+                return this->visitIntegerType(node->rawCast<IntegerType>());
             }
 
             case TypeKind::Boolean: {
-                return this->visitBooleanType(node->staticCast<BooleanType>());
+                return this->visitBooleanType(node->rawCast<BooleanType>());
             }
 
             case TypeKind::String: {
@@ -517,7 +584,11 @@ namespace ionlang {
         }
     }
 
-    void IonIrLoweringPass::visitIntegerType(ionshared::Ptr<IntegerType> node) {
+    void IonIrLoweringPass::visitIntegerType(IntegerType *node) {
+        if (this->pushCachedType(node)) {
+            return;
+        }
+
         ionir::IntegerKind ionIrIntegerKind;
 
         /**
@@ -560,27 +631,35 @@ namespace ionlang {
             }
         }
 
-        this->typeStack.push(IonIrLoweringPass::processTypeQualifiers(
+        this->pushType(node, IonIrLoweringPass::processTypeQualifiers(
             std::make_shared<ionir::IntegerType>(ionIrIntegerKind, node->isSigned),
-            node->qualifiers
+            node
         ));
     }
 
-    void IonIrLoweringPass::visitBooleanType(ionshared::Ptr<BooleanType> node) {
-        this->typeStack.push(IonIrLoweringPass::processTypeQualifiers(
+    void IonIrLoweringPass::visitBooleanType(BooleanType *node) {
+        if (this->pushCachedType(node)) {
+            return;
+        }
+
+        this->pushType(node, IonIrLoweringPass::processTypeQualifiers(
             std::make_shared<ionir::BooleanType>(),
-            node->qualifiers
+            node
         ));
     }
 
-    void IonIrLoweringPass::visitVoidType(ionshared::Ptr<VoidType> node) {
-        this->typeStack.push(IonIrLoweringPass::processTypeQualifiers(
+    void IonIrLoweringPass::visitVoidType(VoidType *node) {
+        if (this->pushCachedType(node)) {
+            return;
+        }
+
+        this->pushType(node, IonIrLoweringPass::processTypeQualifiers(
             std::make_shared<ionir::VoidType>(),
-            node->qualifiers
+            node
         ));
     }
 
-    void IonIrLoweringPass::visitIfStatement(ionshared::Ptr<IfStatement> node) {
+    void IonIrLoweringPass::visitIfStatement(IfStatement *node) {
         ionshared::Ptr<ionir::BasicBlock> ionIrBasicBlockBuffer = this->requireBasicBlock();
 
         Pass::visit(node->condition);
@@ -602,14 +681,11 @@ namespace ionlang {
         // TODO: What if successor block is considered function body (split inherits?) then no value is pushed onto stack?
         ionshared::Ptr<Block> successorBlock;
 
-        // TODO: What about the symbol table? It needs to be migrated from the split statements onwards.
-
         /**
          * Split the block from after this if statement, if there are
          * more statements after this if statement.
          */
         if (parentBlock->statements.size() - 1 >= splitOrder) {
-            // TODO: Symbol table not being migrated (split does not do this).
             successorBlock = parentBlock->slice(splitOrder);
         }
         /**
@@ -617,19 +693,18 @@ namespace ionlang {
          * Simply create an empty block, with the same parent.
          */
         else {
-            // TODO: Symbol table not being migrated.
             successorBlock = std::make_shared<Block>(parentBlock->getUnboxedParent());
         }
 
         // TODO: Hotfix to avoid function body (thus overriding bufferFunction's body).
-        successorBlock->parent = node;
+        successorBlock->parent = node->nativeCast();
 
-        this->visitBlock(successorBlock);
+        this->visitBlock(successorBlock.get());
 
         ionshared::Ptr<ionir::BasicBlock> ionIrSuccessorBasicBlock =
             this->constructStack.pop()->dynamicCast<ionir::BasicBlock>();
 
-        this->visitBlock(node->consequentBlock);
+        this->visitBlock(node->consequentBlock.get());
 
         ionshared::Ptr<ionir::BasicBlock> ionIrConsequentBasicBlock =
             this->constructStack.pop()->dynamicCast<ionir::BasicBlock>();
@@ -652,7 +727,7 @@ namespace ionlang {
         ionIrConsequentBasicBlock->link(ionIrSuccessorBasicBlock);
 
         if (node->hasAlternativeBlock()) {
-            this->visitBlock(*node->alternativeBlock);
+            this->visitBlock(node->alternativeBlock->get());
 
             ionshared::Ptr<ionir::BasicBlock> ionIrAlternativeBlock =
                 this->constructStack.pop()->dynamicCast<ionir::BasicBlock>();
@@ -665,7 +740,7 @@ namespace ionlang {
         }
     }
 
-    void IonIrLoweringPass::visitReturnStatement(ionshared::Ptr<ReturnStatement> node) {
+    void IonIrLoweringPass::visitReturnStatement(ReturnStatement *node) {
         ionshared::Ptr<ionir::InstBuilder> ionIrInstBuilder = this->requireBuilder();
         ionshared::OptPtr<ionir::Value<>> ionIrValue = std::nullopt;
 
@@ -687,19 +762,19 @@ namespace ionlang {
         this->constructStack.push(ionIrReturnInst);
     }
 
-    void IonIrLoweringPass::visitAssignmentStatement(ionshared::Ptr<AssignmentStatement> node) {
+    void IonIrLoweringPass::visitAssignmentStatement(AssignmentStatement *node) {
         ionshared::Ptr<ionir::InstBuilder> ionIrBuilderBuffer = this->requireBuilder();
 
         if (!node->variableDeclStatementRef->isResolved()) {
             // TODO: Better error.
             throw std::runtime_error("Expected variable declaration reference to be resolved");
         }
-        else if (!this->symbolTable.contains(**node->variableDeclStatementRef)) {
+        else if (!this->symbolTable.contains(node->variableDeclStatementRef->value->get())) {
             // TODO: Better error.
             throw std::runtime_error("Could not find corresponding IonIR alloca instruction on the symbol table");
         }
 
-        ionshared::Ptr<VariableDeclStatement> variableDecl = **node->variableDeclStatementRef;
+        VariableDeclStatement *variableDecl = node->variableDeclStatementRef->value->get();
 
         ionshared::Ptr<ionir::AllocaInst> ionIrAllocaInst =
             *this->symbolTable.find<ionir::AllocaInst>(variableDecl);
@@ -712,13 +787,21 @@ namespace ionlang {
         );
     }
 
-    void IonIrLoweringPass::visitVariableDecl(ionshared::Ptr<VariableDeclStatement> node) {
+    void IonIrLoweringPass::visitExprWrapperStatement(ExprWrapperStatement *node) {
+        /**
+         * Literals may be wrapped as expressions, so dispatch through
+         * the value kind rather than the expression kind.
+         */
+        this->visitValue(node->getExpression().get());
+    }
+
+    void IonIrLoweringPass::visitVariableDecl(VariableDeclStatement *node) {
         this->requireBuilder();
 
         ionshared::Ptr<ionir::InstBuilder> ionIrInstBuilder = *this->buffers.builder;
 
         // First, visit the type and create a IonIR alloca inst,  and push it onto the stack.
-        this->visitType(node->type);
+        this->visitType(node->type.get());
 
         ionshared::Ptr<ionir::Type> ionIrType = this->typeStack.pop();
 
@@ -742,8 +825,8 @@ namespace ionlang {
         );
     }
 
-    void IonIrLoweringPass::visitCallExpr(ionshared::Ptr<CallExpr> node) {
-        PtrRef<> calleeRef = node->calleeRef;
+    void IonIrLoweringPass::visitCallExpr(CallExpr *node) {
+        const PtrRef<> &calleeRef = node->calleeRef;
 
         if (!calleeRef->isResolved()) {
             throw std::runtime_error("Expected callee function reference to be resolved");
@@ -762,7 +845,7 @@ namespace ionlang {
          * Visit the callee it earlier if it hasn't been visited/emitted
          * at this point.
          */
-        if (!this->symbolTable.contains(callee)) {
+        if (!this->symbolTable.contains(callee.get())) {
             this->lockBuffers([&, this] {
                 this->visit(callee);
             });
@@ -772,7 +855,7 @@ namespace ionlang {
         }
 
         ionshared::OptPtr<ionir::Construct> ionIrCalleeResult =
-            this->symbolTable.find(callee);
+            this->symbolTable.find(callee.get());
 
         if (!ionshared::util::hasValue(ionIrCalleeResult)) {
             throw std::runtime_error("Corresponding emitted IonIR entity could not be found on symbol table");
@@ -781,7 +864,7 @@ namespace ionlang {
         std::vector<ionshared::Ptr<ionir::Construct>> ionIrArgs = {};
 
         for (const auto &arg : node->args) {
-            arg->accept(*this);
+            this->visitValue(arg.get());
             ionIrArgs.push_back(this->constructStack.pop());
         }
 
@@ -797,7 +880,7 @@ namespace ionlang {
         this->constructStack.push(ionIrCallInst);
     }
 
-    void IonIrLoweringPass::visitStruct(ionshared::Ptr<Struct> node) {
+    void IonIrLoweringPass::visitStruct(Struct *node) {
         ionshared::Ptr<ionir::Module> ionIrModuleBuffer = this->requireModule();
         ionir::Scope globalSymbolTable = ionIrModuleBuffer->context->getGlobalScope();
 
@@ -806,15 +889,13 @@ namespace ionlang {
             throw std::runtime_error("Struct was already previously defined in the module");
         }
 
-        auto fieldsMap = node->fields->unwrap();
-
         ionir::Fields ionIrFields =
             ionshared::util::makePtrSymbolTable<ionir::Type>();
 
-        for (const auto &[name, type] : fieldsMap) {
-            this->visitType(type);
+        node->fields->forEach([&](const std::string &name, const ionshared::Ptr<Type> &type) {
+            this->visitType(type.get());
             ionIrFields->set(name, this->typeStack.pop());
-        }
+        });
 
         ionshared::Ptr<ionir::Struct> ionIrStruct =
             std::make_shared<ionir::Struct>(node->name, ionIrFields);
@@ -1,89 +1,264 @@
+#include <algorithm>
+#include <stdexcept>
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
-    Pass::Pass(ionshared::Ptr<ionshared::PassContext> context) :
-        ionshared::BasePass<Construct>(std::move(context)) {
+    Pass::Pass(
+        ionshared::Ptr<ionshared::PassContext> context,
+        PassScope passScope
+    ) :
+        ionshared::BasePass<Construct>(std::move(context)),
+        passScope(passScope),
+        analysisManager(nullptr),
+        visitedNodeCount(0),
+        traversalStack() {
         //
     }
 
-    void Pass::visit(ionshared::Ptr<Construct> node) {
-        // TODO: Hotfix for circular dep.
-        if (node->constructKind == ConstructKind::Ref) {
-            this->visitRef(node->staticCast<Ref<>>());
-        }
-        else if (node->constructKind == ConstructKind::Value) {
-            this->visitValue(node->staticCast<Value<>>());
-        }
-        // TODO: This should be at the top alone with visitChildren() once fixed.
-        else {
-            node->accept(*this);
+    ionshared::Ptr<Pass> Pass::clone() const {
+        // TODO: Use diagnostics.
+        throw std::runtime_error("Pass does not support being cloned");
+    }
+
+    void Pass::mergeStatistics(const Pass &clone) {
+        this->visitedNodeCount += clone.visitedNodeCount;
+    }
+
+    bool Pass::isFusible() const {
+        return false;
+    }
+
+    std::string_view Pass::getPassName() const {
+        return "Pass";
+    }
+
+    ionshared::Ptr<AnalysisManager> Pass::requireAnalysisManager() {
+        if (this->analysisManager == nullptr) {
+            this->analysisManager = std::make_shared<AnalysisManager>();
         }
 
-        this->visitChildren(node);
+        return this->analysisManager;
     }
 
-    void Pass::visitChildren(ionshared::Ptr<Construct> node) {
-        // TODO: Will it cause StackOverflow error with large ASTs?
-        Ast children = node->getChildNodes();
+    void Pass::visit(ionshared::Ptr<Construct> node) {
+        this->resetTraversalState();
+        this->traverse(node.get());
+    }
+
+    void Pass::resetTraversalState() {
+        //
+    }
 
+    void Pass::visitNode(Construct *node) {
         /**
-         * After visiting the node, attempt to visit all its children
-         * as well.
+         * Dispatch on the construct's kind tag rather than through the
+         * virtual accept() method. The tag identifies the derived type,
+         * therefore static casts are safe and no RTTI lookup is required.
          */
-        for (const auto &child : children) {
-            this->visit(child);
+        switch (node->constructKind) {
+            case ConstructKind::Type: {
+                Type *type = node->rawCast<Type>();
+
+                switch (type->typeKind) {
+                    case TypeKind::Void: {
+                        return this->visitVoidType(node->rawCast<VoidType>());
+                    }
+
+                    case TypeKind::Integer: {
+                        return this->visitIntegerType(node->rawCast<IntegerType>());
+                    }
+
+                    case TypeKind::Boolean: {
+                        return this->visitBooleanType(node->rawCast<BooleanType>());
+                    }
+
+                    default: {
+                        return this->visitType(type);
+                    }
+                }
+            }
+
+            case ConstructKind::Prototype: {
+                return this->visitPrototype(node->rawCast<Prototype>());
+            }
+
+            case ConstructKind::Function: {
+                return this->visitFunction(node->rawCast<Function>());
+            }
+
+            case ConstructKind::Extern: {
+                return this->visitExtern(node->rawCast<Extern>());
+            }
+
+            case ConstructKind::Global: {
+                return this->visitGlobal(node->rawCast<Global>());
+            }
+
+            case ConstructKind::Block: {
+                return this->visitBlock(node->rawCast<Block>());
+            }
+
+            case ConstructKind::Module: {
+                return this->visitModule(node->rawCast<Module>());
+            }
+
+            case ConstructKind::Ref: {
+                return this->visitRef(node->rawCast<Ref<>>());
+            }
+
+            case ConstructKind::Value: {
+                return this->visitValue(node->rawCast<Value<>>());
+            }
+
+            case ConstructKind::Statement: {
+                return this->visitStatement(node->rawCast<Statement>());
+            }
+
+            case ConstructKind::ErrorMarker: {
+                return this->visitErrorMarker(node->rawCast<ErrorMarker>());
+            }
+
+            case ConstructKind::Attribute: {
+                return this->visitAttribute(node->rawCast<Attribute>());
+            }
+
+            case ConstructKind::Struct: {
+                return this->visitStruct(node->rawCast<Struct>());
+            }
+
+            default: {
+                throw std::runtime_error("Unknown construct kind");
+            }
+        }
+    }
+
+    void Pass::visitChildren(Construct *node) {
+        node->forEachChild([this](Construct *child) {
+            this->traverse(child);
+        });
+    }
+
+    void Pass::traverse(Construct *root) {
+        /**
+         * A visit method may itself start a traversal (ex. to visit a
+         * sub-tree explicitly), in which case the stack is shared. Only
+         * frames above this base belong to the current traversal.
+         */
+        const size_t base = this->traversalStack.size();
+
+        this->traversalStack.push_back(TraversalFrame{root, false});
+
+        try {
+            while (this->traversalStack.size() > base) {
+                TraversalFrame &frame = this->traversalStack.back();
+
+                // All children have been visited, leave the node.
+                if (frame.childrenQueued) {
+                    Construct *node = frame.node;
+
+                    this->traversalStack.pop_back();
+                    this->afterVisitChildren(node);
+
+                    continue;
+                }
+
+                frame.childrenQueued = true;
+
+                /**
+                 * Keep a local copy, since pushing children might reallocate
+                 * the stack and invalidate the frame reference.
+                 */
+                Construct *node = frame.node;
+
+                this->visitNode(node);
+                this->visitedNodeCount++;
+
+                if (!this->shouldVisitChildren(node)) {
+                    continue;
+                }
+
+                const size_t childrenBegin = this->traversalStack.size();
+
+                node->forEachChild([this](Construct *child) {
+                    this->traversalStack.push_back(TraversalFrame{child, false});
+                });
+
+                // Reverse the pushed frames, so children are visited first to last.
+                std::reverse(
+                    this->traversalStack.begin() + childrenBegin,
+                    this->traversalStack.end()
+                );
+            }
+        }
+        catch (...) {
+            // Discard this traversal's frames so the stack may be re-used.
+            this->traversalStack.resize(base);
+
+            throw;
         }
     }
 
-    void Pass::visitModule(ionshared::Ptr<Module> node) {
+    bool Pass::shouldVisitChildren(Construct *node) {
+        return true;
+    }
+
+    void Pass::afterVisitChildren(Construct *node) {
         //
     }
 
-    void Pass::visitPrototype(ionshared::Ptr<Prototype> node) {
+    void Pass::visitModule(Module *node) {
         //
     }
 
-    void Pass::visitExtern(ionshared::Ptr<Extern> node) {
+    void Pass::visitPrototype(Prototype *node) {
         //
     }
 
-    void Pass::visitBlock(ionshared::Ptr<Block> node) {
+    void Pass::visitExtern(Extern *node) {
         //
     }
 
-    void Pass::visitStatement(ionshared::Ptr<Statement> node) {
+    void Pass::visitBlock(Block *node) {
+        //
+    }
+
+    void Pass::visitStatement(Statement *node) {
         switch (node->statementKind) {
             case StatementKind::If: {
-                this->visitIfStatement(node->dynamicCast<IfStatement>());
+                this->visitIfStatement(node->rawCast<IfStatement>());
 
                 break;
             }
 
             case StatementKind::Return: {
-                this->visitReturnStatement(node->dynamicCast<ReturnStatement>());
+                this->visitReturnStatement(node->rawCast<ReturnStatement>());
 
                 break;
             }
 
             case StatementKind::VariableDeclaration: {
-                this->visitVariableDecl(node->dynamicCast<VariableDeclStatement>());
+                this->visitVariableDecl(node->rawCast<VariableDeclStatement>());
 
                 break;
             }
 
             case StatementKind::Assignment: {
-                this->visitAssignmentStatement(node->dynamicCast<AssignmentStatement>());
+                this->visitAssignmentStatement(node->rawCast<AssignmentStatement>());
 
                 break;
             }
 
             case StatementKind::ExprWrapper: {
-                this->visitExpression(node->dynamicCast<ExprWrapperStatement>()->getExpression());
+                this->visitExprWrapperStatement(node->rawCast<ExprWrapperStatement>());
 
                 break;
             }
 
-            // TODO: Add for all statements. Critical!
+            case StatementKind::BlockWrapper: {
+                this->visitBlockWrapperStatement(node->rawCast<BlockWrapperStatement>());
+
+                break;
+            }
 
             default: {
                 throw std::runtime_error("Unknown statement kind");
@@ -91,47 +266,51 @@ namespace ionlang {
         }
     }
 
-    void Pass::visitIfStatement(ionshared::Ptr<IfStatement> node) {
+    void Pass::visitIfStatement(IfStatement *node) {
         //
     }
 
-    void Pass::visitReturnStatement(ionshared::Ptr<ReturnStatement> node) {
+    void Pass::visitReturnStatement(ReturnStatement *node) {
         //
     }
 
-    void Pass::visitAssignmentStatement(ionshared::Ptr<AssignmentStatement> node) {
+    void Pass::visitAssignmentStatement(AssignmentStatement *node) {
         //
     }
 
-    void Pass::visitExprWrapperStatement(ionshared::Ptr<ExprWrapperStatement> node) {
+    void Pass::visitExprWrapperStatement(ExprWrapperStatement *node) {
         //
     }
 
-    void Pass::visitBlockWrapperStatement(ionshared::Ptr<BlockWrapperStatement> node) {
+    void Pass::visitBlockWrapperStatement(BlockWrapperStatement *node) {
         //
     }
 
-    void Pass::visitExpression(ionshared::Ptr<Expression> node) {
+    void Pass::visitExpression(Expression *node) {
         switch (node->expressionKind) {
             case ExpressionKind::UnaryOperation: {
-                this->visitUnaryOperation(node->dynamicCast<UnaryOperation>());
+                this->visitUnaryOperation(node->rawCast<UnaryOperation>());
 
                 break;
             }
 
             case ExpressionKind::BinaryOperation: {
-                this->visitBinaryOperation(node->dynamicCast<BinaryOperation>());
+                this->visitBinaryOperation(node->rawCast<BinaryOperation>());
 
                 break;
             }
 
             case ExpressionKind::Call: {
-                this->visitCallExpr(node->dynamicCast<CallExpr>());
+                this->visitCallExpr(node->rawCast<CallExpr>());
 
                 break;
             }
 
-            // TODO: Add support for missing expression(s)...
+            case ExpressionKind::VariableRef: {
+                this->visitVariableRefExpr(node->rawCast<VariableRefExpr>());
+
+                break;
+            }
 
             default: {
                 throw std::runtime_error("Unknown expression kind");
@@ -139,50 +318,50 @@ namespace ionlang {
         }
     }
 
-    void Pass::visitUnaryOperation(ionshared::Ptr<UnaryOperation> node) {
+    void Pass::visitUnaryOperation(UnaryOperation *node) {
         //
     }
 
-    void Pass::visitBinaryOperation(ionshared::Ptr<BinaryOperation> node) {
+    void Pass::visitBinaryOperation(BinaryOperation *node) {
         //
     }
 
-    void Pass::visitCallExpr(ionshared::Ptr<CallExpr> node) {
+    void Pass::visitCallExpr(CallExpr *node) {
         //
     }
 
-    void Pass::visitVariableRefExpr(ionshared::Ptr<VariableRefExpr> node) {
+    void Pass::visitVariableRefExpr(VariableRefExpr *node) {
         //
     }
 
-    void Pass::visitValue(ionshared::Ptr<Value<>> node) {
+    void Pass::visitValue(Value<> *node) {
         switch (node->getValueKind()) {
             case ValueKind::Character: {
-                this->visitCharLiteral(node->dynamicCast<CharLiteral>());
+                this->visitCharLiteral(node->rawCast<CharLiteral>());
 
                 break;
             }
 
             case ValueKind::Integer: {
-                this->visitIntegerLiteral(node->dynamicCast<IntegerLiteral>());
+                this->visitIntegerLiteral(node->rawCast<IntegerLiteral>());
 
                 break;
             }
 
             case ValueKind::String: {
-                this->visitStringLiteral(node->dynamicCast<StringLiteral>());
+                this->visitStringLiteral(node->rawCast<StringLiteral>());
 
                 break;
             }
 
             case ValueKind::Boolean: {
-                this->visitBooleanLiteral(node->dynamicCast<BooleanLiteral>());
+                this->visitBooleanLiteral(node->rawCast<BooleanLiteral>());
 
                 break;
             }
 
             case ValueKind::Expression: {
-                this->visitExpression(node->dynamicCast<Expression>());
+                this->visitExpression(node->rawCast<Expression>());
 
                 break;
             }
@@ -193,67 +372,67 @@ namespace ionlang {
         }
     }
 
-    void Pass::visitBooleanLiteral(ionshared::Ptr<BooleanLiteral> node) {
+    void Pass::visitBooleanLiteral(BooleanLiteral *node) {
         //
     }
 
-    void Pass::visitCharLiteral(ionshared::Ptr<CharLiteral> node) {
+    void Pass::visitCharLiteral(CharLiteral *node) {
         //
     }
 
-    void Pass::visitIntegerLiteral(ionshared::Ptr<IntegerLiteral> node) {
+    void Pass::visitIntegerLiteral(IntegerLiteral *node) {
         //
     }
 
-    void Pass::visitStringLiteral(ionshared::Ptr<StringLiteral> node) {
+    void Pass::visitStringLiteral(StringLiteral *node) {
         //
     }
 
-    void Pass::visitType(ionshared::Ptr<Type> node) {
+    void Pass::visitType(Type *node) {
         //
     }
 
-    void Pass::visitVoidType(ionshared::Ptr<VoidType> node) {
+    void Pass::visitVoidType(VoidType *node) {
         //
     }
 
-    void Pass::visitBooleanType(ionshared::Ptr<BooleanType> node) {
+    void Pass::visitBooleanType(BooleanType *node) {
         //
     }
 
-    void Pass::visitRef(PtrRef<> node) {
+    void Pass::visitRef(Ref<> *node) {
         //
     }
 
-    void Pass::visitFunction(ionshared::Ptr<Function> node) {
+    void Pass::visitFunction(Function *node) {
         //
     }
 
-    void Pass::visitVariableDecl(ionshared::Ptr<VariableDeclStatement> node) {
+    void Pass::visitVariableDecl(VariableDeclStatement *node) {
         //
     }
 
-    void Pass::visitScopeAnchor(ionshared::Ptr<ionshared::Scoped<Construct>> node) {
+    void Pass::visitScopeAnchor(ionshared::Scoped<Construct> *node) {
         //
     }
 
-    void Pass::visitIntegerType(ionshared::Ptr<IntegerType> node) {
+    void Pass::visitIntegerType(IntegerType *node) {
         //
     }
 
-    void Pass::visitGlobal(ionshared::Ptr <Global> node) {
+    void Pass::visitGlobal(Global *node) {
         //
     }
 
-    void Pass::visitErrorMarker(ionshared::Ptr<ErrorMarker> node) {
+    void Pass::visitErrorMarker(ErrorMarker *node) {
         //
     }
 
-    void Pass::visitAttribute(ionshared::Ptr<Attribute> node) {
+    void Pass::visitAttribute(Attribute *node) {
         //
     }
 
-    void Pass::visitStruct(ionshared::Ptr<Struct> node) {
+    void Pass::visitStruct(Struct *node) {
         //
     }
 }
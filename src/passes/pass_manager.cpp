@@ -0,0 +1,208 @@
+#include <ionlang/passes/pass_manager.h>
+
+namespace ionlang {
+    std::vector<ionshared::Ptr<Function>> PassManager::collectFunctions(const Ast &ast) {
+        std::vector<ionshared::Ptr<Function>> functions = {};
+
+        for (const auto &construct : ast) {
+            if (construct->constructKind == ConstructKind::Function) {
+                functions.push_back(construct->staticCast<Function>());
+            }
+            else if (construct->constructKind == ConstructKind::Module) {
+                construct->rawCast<Module>()->symbolTable->forEach([&](
+                    const std::string &key,
+                    const ionshared::Ptr<Construct> &topLevelConstruct
+                ) {
+                    if (topLevelConstruct->constructKind == ConstructKind::Function) {
+                        functions.push_back(topLevelConstruct->staticCast<Function>());
+                    }
+                });
+            }
+        }
+
+        return functions;
+    }
+
+    PassManager::PassManager(size_t workerCount) :
+        passes(),
+        workerCount(workerCount),
+        fusePasses(false),
+        analysisManager(std::make_shared<AnalysisManager>()),
+        pool(nullptr) {
+        //
+    }
+
+    WorkStealingPool &PassManager::requirePool() {
+        // Threads are only spawned once a function stage is run.
+        if (this->pool == nullptr) {
+            this->pool = std::make_unique<WorkStealingPool>(this->workerCount);
+        }
+
+        return *this->pool;
+    }
+
+    std::vector<ionshared::Ptr<Pass>> PassManager::createPipeline() const {
+        if (!this->fusePasses) {
+            return this->passes;
+        }
+
+        std::vector<ionshared::Ptr<Pass>> pipeline = {};
+        std::vector<ionshared::Ptr<Pass>> group = {};
+
+        auto flushGroup = [&] {
+            // A single pass gains nothing from being fused.
+            if (group.size() == 1) {
+                pipeline.push_back(group.front());
+            }
+            else if (group.size() > 1) {
+                ionshared::Ptr<FusedPass> fusedPass = std::make_shared<FusedPass>(group);
+
+                fusedPass->analysisManager = this->analysisManager;
+                pipeline.push_back(fusedPass);
+            }
+
+            group.clear();
+        };
+
+        for (const auto &pass : this->passes) {
+            if (!pass->isFusible()) {
+                flushGroup();
+                pipeline.push_back(pass);
+
+                continue;
+            }
+            else if (!FusedPass::canFuse(group, *pass)) {
+                flushGroup();
+            }
+
+            group.push_back(pass);
+        }
+
+        flushGroup();
+
+        return pipeline;
+    }
+
+    void PassManager::runFunctionStage(
+        const std::vector<ionshared::Ptr<Pass>> &stage,
+        const std::vector<ionshared::Ptr<Function>> &functions
+    ) {
+        ProfileScope profileScope = ProfileScope("FunctionStage", "stage");
+        WorkStealingPool &pool = this->requirePool();
+
+        /**
+         * The first worker (the calling thread) uses the registered
+         * passes themselves, while the others use their own clones, as
+         * passes keep per-traversal state. Clones are only created once
+         * a worker runs its first task, and each slot is only ever
+         * accessed by its own worker.
+         */
+        std::vector<std::vector<ionshared::Ptr<Pass>>> workerPasses(pool.getWorkerCount());
+
+        workerPasses[0] = stage;
+
+        pool.run(functions.size(), [&](size_t workerIndex, size_t taskIndex) {
+            std::vector<ionshared::Ptr<Pass>> &passes = workerPasses[workerIndex];
+
+            if (passes.empty()) {
+                passes.reserve(stage.size());
+
+                for (const auto &pass : stage) {
+                    ionshared::Ptr<Pass> clone = pass->clone();
+
+                    clone->analysisManager = pass->analysisManager;
+                    passes.push_back(std::move(clone));
+                }
+            }
+
+            for (const auto &pass : passes) {
+                ProfileScope profileScope = ProfileScope(pass->getPassName(), "pass");
+                uint64_t visitedNodeCount = pass->visitedNodeCount;
+
+                pass->visit(functions[taskIndex]);
+                profileScope.addNodes(pass->visitedNodeCount - visitedNodeCount);
+            }
+        });
+
+        // Clones are discarded, so their statistics are gathered on the registered passes.
+        for (size_t workerIndex = 1; workerIndex < workerPasses.size(); workerIndex++) {
+            const std::vector<ionshared::Ptr<Pass>> &passes = workerPasses[workerIndex];
+
+            for (size_t i = 0; i < passes.size(); i++) {
+                stage[i]->mergeStatistics(*passes[i]);
+            }
+        }
+    }
+
+    const std::vector<ionshared::Ptr<Pass>> &PassManager::getPasses() const noexcept {
+        return this->passes;
+    }
+
+    bool PassManager::isFusionEnabled() const noexcept {
+        return this->fusePasses;
+    }
+
+    void PassManager::setFusionEnabled(bool fusePasses) noexcept {
+        this->fusePasses = fusePasses;
+    }
+
+    ionshared::Ptr<AnalysisManager> PassManager::getAnalysisManager() const noexcept {
+        return this->analysisManager;
+    }
+
+    void PassManager::registerPass(ionshared::Ptr<Pass> pass) {
+        if (pass->analysisManager == nullptr) {
+            pass->analysisManager = this->analysisManager;
+        }
+
+        this->passes.push_back(std::move(pass));
+    }
+
+    void PassManager::run(const Ast &ast) {
+        std::vector<ionshared::Ptr<Pass>> stage = {};
+        std::vector<ionshared::Ptr<Function>> functions = {};
+        bool isFunctionListStale = true;
+
+        auto flushStage = [&] {
+            if (stage.empty()) {
+                return;
+            }
+
+            // Module-scoped passes may have added or removed functions.
+            if (isFunctionListStale) {
+                functions = PassManager::collectFunctions(ast);
+                isFunctionListStale = false;
+            }
+
+            this->runFunctionStage(stage, functions);
+            stage.clear();
+        };
+
+        for (const auto &pass : this->createPipeline()) {
+            if (pass->passScope == PassScope::Function) {
+                stage.push_back(pass);
+
+                continue;
+            }
+
+            // Module-scoped passes act as barriers.
+            flushStage();
+
+            ProfileScope profileScope = ProfileScope(pass->getPassName(), "pass");
+            uint64_t visitedNodeCount = pass->visitedNodeCount;
+
+            for (const auto &construct : ast) {
+                pass->visit(construct);
+            }
+
+            profileScope.addNodes(pass->visitedNodeCount - visitedNodeCount);
+
+            isFunctionListStale = true;
+        }
+
+        flushStage();
+
+        // Results are keyed by construct, and the AST may be freed once done.
+        this->analysisManager->clear();
+    }
+}
@@ -0,0 +1,61 @@
+#include <ionlang/passes/rewrite_pass.h>
+
+namespace ionlang {
+    RewritePass::RewritePass(
+        ionshared::Ptr<ionshared::PassContext> context,
+        PassScope passScope
+    ) :
+        Pass(std::move(context), passScope),
+        pendingReplacements(),
+        marks(),
+        replacementCount(0) {
+        //
+    }
+
+    void RewritePass::resetTraversalState() {
+        this->pendingReplacements.clear();
+        this->marks.clear();
+    }
+
+    void RewritePass::mergeStatistics(const Pass &clone) {
+        Pass::mergeStatistics(clone);
+        this->replacementCount += static_cast<const RewritePass &>(clone).replacementCount;
+    }
+
+    void RewritePass::visitNode(Construct *node) {
+        this->marks.push_back(this->pendingReplacements.size());
+
+        Pass::visitNode(node);
+    }
+
+    void RewritePass::afterVisitChildren(Construct *node) {
+        const size_t mark = this->marks.back();
+
+        this->marks.pop_back();
+
+        /**
+         * Replacements of grandchildren were consumed by the children
+         * themselves, so the ones left belong to direct children.
+         */
+        for (size_t i = mark; i < this->pendingReplacements.size(); i++) {
+            PendingReplacement &pendingReplacement = this->pendingReplacements[i];
+
+            if (node->replaceChild(pendingReplacement.node, std::move(pendingReplacement.replacement))) {
+                this->replacementCount++;
+            }
+        }
+
+        this->pendingReplacements.resize(mark);
+
+        ionshared::Ptr<Construct> replacement = this->rewrite(node);
+
+        // The root has no parent to be replaced within.
+        if (replacement != nullptr && !this->marks.empty()) {
+            this->pendingReplacements.push_back(PendingReplacement{node, std::move(replacement)});
+        }
+    }
+
+    uint64_t RewritePass::getReplacementCount() const noexcept {
+        return this->replacementCount;
+    }
+}
@@ -0,0 +1,310 @@
+#include <ionlang/misc/util.h>
+#include <ionlang/passes/semantic/algebraic_simplification_pass.h>
+
+namespace ionlang {
+    std::optional<int64_t> AlgebraicSimplificationPass::findInteger(
+        Construct *construct,
+        const IntegerType &type
+    ) {
+        std::optional<Constant> constant = ConstantEvaluator::findConstant(construct);
+
+        if (!constant.has_value() || !std::holds_alternative<IntegerConstant>(*constant)) {
+            return std::nullopt;
+        }
+
+        const IntegerConstant &integerConstant = std::get<IntegerConstant>(*constant);
+
+        // Implicit conversions are not performed.
+        if (integerConstant.type->integerKind != type.integerKind
+            || integerConstant.type->isSigned != type.isSigned) {
+            return std::nullopt;
+        }
+
+        return integerConstant.value;
+    }
+
+    std::optional<uint32_t> AlgebraicSimplificationPass::findPowerOfTwo(int64_t value, const IntegerType &type) {
+        if (!ConstantEvaluator::findBitWidth(type).has_value() || (type.isSigned && value <= 0)) {
+            return std::nullopt;
+        }
+
+        // Unsigned values are zero-extended, barring 64-bit ones which are kept as is.
+        uint64_t bits = static_cast<uint64_t>(value);
+
+        if (bits == 0 || (bits & (bits - 1)) != 0) {
+            return std::nullopt;
+        }
+
+        uint32_t power = 0;
+
+        while ((bits >> power) != 1) {
+            power++;
+        }
+
+        return power;
+    }
+
+    ionshared::Ptr<Construct> AlgebraicSimplificationPass::simplifyUnary(UnaryOperation *unaryOperation) {
+        ionshared::Ptr<Construct> value = unaryOperation->getValue();
+
+        switch (unaryOperation->getOperator()) {
+            case Operator::Addition: {
+                return value;
+            }
+
+            // Double negation.
+            case Operator::Subtraction: {
+                if (value->constructKind != ConstructKind::Value
+                    || value->rawCast<Value<>>()->getValueKind() != ValueKind::Expression
+                    || value->rawCast<Expression>()->expressionKind != ExpressionKind::UnaryOperation) {
+                    return nullptr;
+                }
+
+                auto innerOperation = value->rawCast<UnaryOperation>();
+
+                return innerOperation->getOperator() == Operator::Subtraction
+                    ? innerOperation->getValue()
+                    : nullptr;
+            }
+
+            default: {
+                return nullptr;
+            }
+        }
+    }
+
+    ionshared::Ptr<Construct> AlgebraicSimplificationPass::simplifyBinary(BinaryOperation *binaryOperation) {
+        ionshared::Ptr<Type> type = binaryOperation->type;
+
+        if (!binaryOperation->hasRightSide() || type == nullptr || type->typeKind != TypeKind::Integer) {
+            return nullptr;
+        }
+
+        ionshared::Ptr<IntegerType> integerType = type->staticCast<IntegerType>();
+        Operator operation = binaryOperation->getOperator();
+        ionshared::Ptr<Construct> leftSide = binaryOperation->getLeftSide();
+        ionshared::Ptr<Construct> rightSide = *binaryOperation->getRightSide();
+        std::optional<int64_t> leftValue = AlgebraicSimplificationPass::findInteger(leftSide.get(), *integerType);
+        std::optional<int64_t> rightValue = AlgebraicSimplificationPass::findInteger(rightSide.get(), *integerType);
+
+        auto makeInteger = [&integerType](int64_t value) {
+            return std::make_shared<IntegerLiteral>(integerType, value);
+        };
+
+        auto makeOperation = [&](
+            Operator newOperation,
+            ionshared::Ptr<Construct> newLeftSide,
+            ionshared::Ptr<Construct> newRightSide
+        ) {
+            ionshared::Ptr<BinaryOperation> result = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+                type,
+                newOperation,
+                std::move(newLeftSide),
+                std::move(newRightSide)
+            });
+
+            result->sourceLocation = binaryOperation->sourceLocation;
+
+            return result;
+        };
+
+        // Operations on literals alone are left to ConstantFoldingPass.
+        if (leftValue.has_value() && rightValue.has_value()) {
+            return nullptr;
+        }
+
+        bool isCommutative = operation == Operator::Addition
+            || operation == Operator::Multiplication
+            || operation == Operator::BitwiseAnd;
+
+        // Literals have no side effects, so the operands may be swapped.
+        if (isCommutative && leftValue.has_value()) {
+            return makeOperation(operation, rightSide, leftSide);
+        }
+        else if (!rightValue.has_value()) {
+            return nullptr;
+        }
+
+        // Reassociate (x op a) op b into x op (a op b).
+        if (isCommutative
+            && leftSide->constructKind == ConstructKind::Value
+            && leftSide->rawCast<Value<>>()->getValueKind() == ValueKind::Expression
+            && leftSide->rawCast<Expression>()->expressionKind == ExpressionKind::BinaryOperation) {
+            auto innerOperation = leftSide->rawCast<BinaryOperation>();
+
+            std::optional<int64_t> innerValue = innerOperation->getOperator() == operation
+                && innerOperation->type == type
+                && innerOperation->hasRightSide()
+                ? AlgebraicSimplificationPass::findInteger(innerOperation->getRightSide()->get(), *integerType)
+                : std::nullopt;
+
+            if (innerValue.has_value()) {
+                // Overflowing results are wrapped around, just as the operations would be.
+                EvaluationResult result = ConstantEvaluator::evaluateBinary(
+                    operation,
+                    IntegerConstant{integerType, *innerValue},
+                    IntegerConstant{integerType, *rightValue}
+                );
+
+                if (result.value.has_value()) {
+                    return makeOperation(
+                        operation,
+                        innerOperation->getLeftSide(),
+                        ConstantEvaluator::makeLiteral(*result.value, binaryOperation->findTypeContext())
+                    );
+                }
+            }
+        }
+
+        std::optional<uint32_t> power = AlgebraicSimplificationPass::findPowerOfTwo(*rightValue, *integerType);
+
+        switch (operation) {
+            case Operator::Addition:
+            case Operator::Subtraction:
+            case Operator::ShiftLeft:
+            case Operator::ShiftRight: {
+                return *rightValue == 0 ? leftSide : nullptr;
+            }
+
+            case Operator::Multiplication: {
+                if (*rightValue == 1) {
+                    return leftSide;
+                }
+                else if (*rightValue == 0) {
+                    return util::hasCall(leftSide.get()) ? nullptr : rightSide;
+                }
+                else if (power.has_value()) {
+                    return makeOperation(Operator::ShiftLeft, leftSide, makeInteger(*power));
+                }
+
+                return nullptr;
+            }
+
+            case Operator::Division: {
+                if (*rightValue == 1) {
+                    return leftSide;
+                }
+                else if (!integerType->isSigned && power.has_value()) {
+                    return makeOperation(Operator::ShiftRight, leftSide, makeInteger(*power));
+                }
+
+                return nullptr;
+            }
+
+            case Operator::Modulo: {
+                if (*rightValue == 1) {
+                    return util::hasCall(leftSide.get()) ? nullptr : makeInteger(0);
+                }
+                else if (!integerType->isSigned && power.has_value()) {
+                    return makeOperation(
+                        Operator::BitwiseAnd,
+                        leftSide,
+                        makeInteger(static_cast<int64_t>(static_cast<uint64_t>(*rightValue) - 1))
+                    );
+                }
+
+                return nullptr;
+            }
+
+            case Operator::Exponent: {
+                if (*rightValue == 1) {
+                    return leftSide;
+                }
+                else if (*rightValue == 0) {
+                    return util::hasCall(leftSide.get()) ? nullptr : makeInteger(1);
+                }
+                // Square a local by multiplying it with itself.
+                else if (*rightValue == 2
+                    && leftSide->constructKind == ConstructKind::Value
+                    && leftSide->rawCast<Value<>>()->getValueKind() == ValueKind::Expression
+                    && leftSide->rawCast<Expression>()->expressionKind == ExpressionKind::VariableRef) {
+                    PtrRef<VariableDeclStatement> variableDeclRef =
+                        leftSide->rawCast<VariableRefExpr>()->getVariableDecl();
+
+                    ionshared::Ptr<VariableRefExpr> variableRefExpr = std::make_shared<VariableRefExpr>(
+                        std::make_shared<Ref<VariableDeclStatement>>(
+                            variableDeclRef->name,
+                            variableDeclRef->owner.lock(),
+                            variableDeclRef->refKind,
+                            variableDeclRef->value
+                        )
+                    );
+
+                    variableRefExpr->sourceLocation = leftSide->sourceLocation;
+
+                    return makeOperation(Operator::Multiplication, leftSide, variableRefExpr);
+                }
+
+                return nullptr;
+            }
+
+            case Operator::BitwiseAnd: {
+                return *rightValue == 0 && !util::hasCall(leftSide.get())
+                    ? rightSide
+                    : nullptr;
+            }
+
+            default: {
+                return nullptr;
+            }
+        }
+    }
+
+    ionshared::Ptr<Construct> AlgebraicSimplificationPass::rewrite(Construct *node) {
+        ionshared::Ptr<Construct> replacement = nullptr;
+        Construct *current = node;
+
+        while (current->constructKind == ConstructKind::Value
+            && current->rawCast<Value<>>()->getValueKind() == ValueKind::Expression) {
+            ionshared::Ptr<Construct> next;
+
+            switch (current->rawCast<Expression>()->expressionKind) {
+                case ExpressionKind::UnaryOperation: {
+                    next = AlgebraicSimplificationPass::simplifyUnary(current->rawCast<UnaryOperation>());
+
+                    break;
+                }
+
+                case ExpressionKind::BinaryOperation: {
+                    next = AlgebraicSimplificationPass::simplifyBinary(current->rawCast<BinaryOperation>());
+
+                    break;
+                }
+
+                default: {
+                    next = nullptr;
+
+                    break;
+                }
+            }
+
+            if (next == nullptr) {
+                break;
+            }
+
+            replacement = next;
+            current = replacement.get();
+        }
+
+        return replacement;
+    }
+
+    AlgebraicSimplificationPass::AlgebraicSimplificationPass(
+        ionshared::Ptr<ionshared::PassContext> context
+    ) :
+        RewritePass(std::move(context), PassScope::Function) {
+        //
+    }
+
+    ionshared::Ptr<Pass> AlgebraicSimplificationPass::clone() const {
+        return std::make_shared<AlgebraicSimplificationPass>(this->context);
+    }
+
+    bool AlgebraicSimplificationPass::isFusible() const {
+        return true;
+    }
+
+    std::string_view AlgebraicSimplificationPass::getPassName() const {
+        return "AlgebraicSimplificationPass";
+    }
+}
@@ -0,0 +1,649 @@
+#include <ionlang/passes/semantic/common_subexpression_elimination_pass.h>
+
+namespace ionlang {
+    static size_t combineHash(size_t seed, size_t value) noexcept {
+        return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+    }
+
+    /**
+     * Whether a local with the given name is visible from the block,
+     * either declared on it or on an enclosing block.
+     */
+    static bool isDeclared(Block *block, const std::string &name) {
+        while (block != nullptr) {
+            if (block->symbolTable->contains(name)) {
+                return true;
+            }
+
+            ionshared::Ptr<Construct> parent = block->parent.lock();
+
+            if (parent == nullptr || parent->constructKind != ConstructKind::Statement) {
+                break;
+            }
+
+            block = parent->rawCast<Statement>()->parent.lock().get();
+        }
+
+        return false;
+    }
+
+    /**
+     * The type of the expression's result. Calls take on the return
+     * type of their callee, as their own type is not set.
+     */
+    static ionshared::Ptr<Type> findType(Expression *expression) {
+        if (expression->expressionKind != ExpressionKind::Call) {
+            return expression->type;
+        }
+
+        PtrRef<> calleeRef = expression->rawCast<CallExpr>()->calleeRef;
+
+        if (!calleeRef->isResolved()) {
+            return nullptr;
+        }
+
+        Construct *callee = calleeRef->value->get();
+
+        switch (callee->constructKind) {
+            case ConstructKind::Function: {
+                return callee->rawCast<Function>()->prototype->returnType;
+            }
+
+            case ConstructKind::Extern: {
+                return callee->rawCast<Extern>()->prototype->returnType;
+            }
+
+            default: {
+                return nullptr;
+            }
+        }
+    }
+
+    bool CommonSubexpressionEliminationPass::isPureCall(CallExpr *callExpr) const {
+        return this->effectSummary != nullptr
+            && callExpr->calleeRef->isResolved()
+            && this->effectSummary->isPure(callExpr->calleeRef->value->get());
+    }
+
+    bool CommonSubexpressionEliminationPass::isCandidate(Construct *value) const {
+        if (value->constructKind != ConstructKind::Value
+            || value->rawCast<Value<>>()->getValueKind() != ValueKind::Expression) {
+            return false;
+        }
+
+        switch (value->rawCast<Expression>()->expressionKind) {
+            case ExpressionKind::UnaryOperation:
+            case ExpressionKind::BinaryOperation: {
+                return true;
+            }
+
+            case ExpressionKind::Call: {
+                return this->isPureCall(value->rawCast<CallExpr>());
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    std::optional<size_t> CommonSubexpressionEliminationPass::hashExpression(Construct *value, Reads &reads) const {
+        if (value->constructKind != ConstructKind::Value) {
+            return std::nullopt;
+        }
+
+        ValueKind valueKind = value->rawCast<Value<>>()->getValueKind();
+        size_t hash = static_cast<size_t>(valueKind);
+
+        switch (valueKind) {
+            case ValueKind::Integer: {
+                auto integerLiteral = value->rawCast<IntegerLiteral>();
+
+                // Types are interned, so equal types share the same instance.
+                hash = combineHash(hash, std::hash<Type *>{}(integerLiteral->type.get()));
+
+                return combineHash(hash, std::hash<int64_t>{}(integerLiteral->value));
+            }
+
+            case ValueKind::Boolean: {
+                return combineHash(hash, std::hash<bool>{}(value->rawCast<BooleanLiteral>()->value));
+            }
+
+            case ValueKind::Character: {
+                return combineHash(hash, std::hash<char>{}(value->rawCast<CharLiteral>()->value));
+            }
+
+            case ValueKind::String: {
+                return combineHash(hash, std::hash<std::string>{}(value->rawCast<StringLiteral>()->value));
+            }
+
+            case ValueKind::Expression: {
+                break;
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+
+        auto expression = value->rawCast<Expression>();
+
+        hash = combineHash(hash, static_cast<size_t>(expression->expressionKind));
+
+        switch (expression->expressionKind) {
+            case ExpressionKind::VariableRef: {
+                PtrRef<VariableDeclStatement> variableDeclRef =
+                    value->rawCast<VariableRefExpr>()->getVariableDecl();
+
+                if (!variableDeclRef->isResolved()) {
+                    return std::nullopt;
+                }
+
+                VariableDeclStatement *variableDecl = variableDeclRef->value->get();
+
+                reads.insert(variableDecl);
+
+                return combineHash(hash, std::hash<VariableDeclStatement *>{}(variableDecl));
+            }
+
+            case ExpressionKind::UnaryOperation: {
+                auto unaryOperation = value->rawCast<UnaryOperation>();
+
+                std::optional<size_t> operandHash = this->hashExpression(unaryOperation->getValue().get(), reads);
+
+                if (!operandHash.has_value()) {
+                    return std::nullopt;
+                }
+
+                hash = combineHash(hash, static_cast<size_t>(unaryOperation->getOperator()));
+                hash = combineHash(hash, std::hash<Type *>{}(unaryOperation->type.get()));
+
+                return combineHash(hash, *operandHash);
+            }
+
+            case ExpressionKind::BinaryOperation: {
+                auto binaryOperation = value->rawCast<BinaryOperation>();
+
+                std::optional<size_t> leftSideHash = this->hashExpression(binaryOperation->getLeftSide().get(), reads);
+
+                if (!leftSideHash.has_value()) {
+                    return std::nullopt;
+                }
+
+                hash = combineHash(hash, static_cast<size_t>(binaryOperation->getOperator()));
+                hash = combineHash(hash, std::hash<Type *>{}(binaryOperation->type.get()));
+                hash = combineHash(hash, *leftSideHash);
+
+                if (!binaryOperation->hasRightSide()) {
+                    return hash;
+                }
+
+                std::optional<size_t> rightSideHash =
+                    this->hashExpression(binaryOperation->getRightSide()->get(), reads);
+
+                if (!rightSideHash.has_value()) {
+                    return std::nullopt;
+                }
+
+                return combineHash(hash, *rightSideHash);
+            }
+
+            case ExpressionKind::Call: {
+                auto callExpr = value->rawCast<CallExpr>();
+
+                // Impure calls may yield different results, or have side effects.
+                if (!this->isPureCall(callExpr)) {
+                    return std::nullopt;
+                }
+
+                hash = combineHash(hash, std::hash<Construct *>{}(callExpr->calleeRef->value->get()));
+
+                for (const auto &arg : callExpr->args) {
+                    std::optional<size_t> argHash = this->hashExpression(arg.get(), reads);
+
+                    if (!argHash.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    hash = combineHash(hash, *argHash);
+                }
+
+                return hash;
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    bool CommonSubexpressionEliminationPass::isEqual(Construct *first, Construct *second) {
+        if (first->constructKind != ConstructKind::Value || second->constructKind != ConstructKind::Value) {
+            return false;
+        }
+
+        ValueKind valueKind = first->rawCast<Value<>>()->getValueKind();
+
+        if (second->rawCast<Value<>>()->getValueKind() != valueKind) {
+            return false;
+        }
+
+        switch (valueKind) {
+            case ValueKind::Integer: {
+                auto firstLiteral = first->rawCast<IntegerLiteral>();
+                auto secondLiteral = second->rawCast<IntegerLiteral>();
+
+                return firstLiteral->type == secondLiteral->type
+                    && firstLiteral->value == secondLiteral->value;
+            }
+
+            case ValueKind::Boolean: {
+                return first->rawCast<BooleanLiteral>()->value == second->rawCast<BooleanLiteral>()->value;
+            }
+
+            case ValueKind::Character: {
+                return first->rawCast<CharLiteral>()->value == second->rawCast<CharLiteral>()->value;
+            }
+
+            case ValueKind::String: {
+                return first->rawCast<StringLiteral>()->value == second->rawCast<StringLiteral>()->value;
+            }
+
+            case ValueKind::Expression: {
+                break;
+            }
+
+            default: {
+                return false;
+            }
+        }
+
+        auto firstExpression = first->rawCast<Expression>();
+        auto secondExpression = second->rawCast<Expression>();
+
+        if (firstExpression->expressionKind != secondExpression->expressionKind
+            || firstExpression->type != secondExpression->type) {
+            return false;
+        }
+
+        switch (firstExpression->expressionKind) {
+            case ExpressionKind::VariableRef: {
+                PtrRef<VariableDeclStatement> firstRef = first->rawCast<VariableRefExpr>()->getVariableDecl();
+                PtrRef<VariableDeclStatement> secondRef = second->rawCast<VariableRefExpr>()->getVariableDecl();
+
+                return firstRef->isResolved()
+                    && secondRef->isResolved()
+                    && firstRef->value->get() == secondRef->value->get();
+            }
+
+            case ExpressionKind::UnaryOperation: {
+                auto firstOperation = first->rawCast<UnaryOperation>();
+                auto secondOperation = second->rawCast<UnaryOperation>();
+
+                return firstOperation->getOperator() == secondOperation->getOperator()
+                    && CommonSubexpressionEliminationPass::isEqual(
+                        firstOperation->getValue().get(),
+                        secondOperation->getValue().get()
+                    );
+            }
+
+            case ExpressionKind::BinaryOperation: {
+                auto firstOperation = first->rawCast<BinaryOperation>();
+                auto secondOperation = second->rawCast<BinaryOperation>();
+
+                if (firstOperation->getOperator() != secondOperation->getOperator()
+                    || firstOperation->hasRightSide() != secondOperation->hasRightSide()
+                    || !CommonSubexpressionEliminationPass::isEqual(
+                        firstOperation->getLeftSide().get(),
+                        secondOperation->getLeftSide().get()
+                    )) {
+                    return false;
+                }
+
+                return !firstOperation->hasRightSide()
+                    || CommonSubexpressionEliminationPass::isEqual(
+                        firstOperation->getRightSide()->get(),
+                        secondOperation->getRightSide()->get()
+                    );
+            }
+
+            case ExpressionKind::Call: {
+                auto firstCall = first->rawCast<CallExpr>();
+                auto secondCall = second->rawCast<CallExpr>();
+
+                if (!firstCall->calleeRef->isResolved()
+                    || !secondCall->calleeRef->isResolved()
+                    || firstCall->calleeRef->value->get() != secondCall->calleeRef->value->get()
+                    || firstCall->args.size() != secondCall->args.size()) {
+                    return false;
+                }
+
+                for (size_t i = 0; i < firstCall->args.size(); i++) {
+                    if (!CommonSubexpressionEliminationPass::isEqual(
+                        firstCall->args[i].get(),
+                        secondCall->args[i].get()
+                    )) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    void CommonSubexpressionEliminationPass::invalidate(OccurrenceTable &table, std::optional<size_t> index) {
+        while (index.has_value()) {
+            Occurrence &occurrence = table.occurrences[*index];
+
+            occurrence.isAvailable = false;
+            index = occurrence.enclosingIndex;
+        }
+    }
+
+    bool CommonSubexpressionEliminationPass::collectAssignments(Construct *construct, Reads &assignments) {
+        std::vector<Construct *> stack = {construct};
+
+        while (!stack.empty()) {
+            Construct *current = stack.back();
+
+            stack.pop_back();
+
+            if (current->constructKind == ConstructKind::Statement
+                && current->rawCast<Statement>()->statementKind == StatementKind::Assignment) {
+                PtrRef<VariableDeclStatement> variableDeclRef =
+                    current->rawCast<AssignmentStatement>()->variableDeclStatementRef;
+
+                if (!variableDeclRef->isResolved()) {
+                    return false;
+                }
+
+                assignments.insert(variableDeclRef->value->get());
+            }
+
+            current->forEachChild([&stack](Construct *child) {
+                stack.push_back(child);
+            });
+        }
+
+        return true;
+    }
+
+    void CommonSubexpressionEliminationPass::kill(
+        OccurrenceTable &table,
+        const std::optional<Reads> &assignments
+    ) {
+        for (Occurrence &occurrence : table.occurrences) {
+            if (!occurrence.isAvailable) {
+                continue;
+            }
+            else if (!assignments.has_value()) {
+                occurrence.isAvailable = false;
+
+                continue;
+            }
+
+            for (const VariableDeclStatement *variableDecl : occurrence.reads) {
+                if (assignments->count(variableDecl) != 0) {
+                    occurrence.isAvailable = false;
+
+                    break;
+                }
+            }
+        }
+    }
+
+    ionshared::Ptr<VariableRefExpr> CommonSubexpressionEliminationPass::createTemporaryRef(
+        Block *block,
+        const ionshared::Ptr<VariableDeclStatement> &temporary
+    ) const {
+        return std::make_shared<VariableRefExpr>(std::make_shared<Ref<VariableDeclStatement>>(
+            temporary->name,
+            block->staticCast<Block>(),
+            RefKind::Variable,
+            temporary
+        ));
+    }
+
+    ionshared::OptPtr<VariableDeclStatement> CommonSubexpressionEliminationPass::materialize(
+        Block *block,
+        OccurrenceTable &table,
+        size_t index
+    ) {
+        Occurrence &occurrence = table.occurrences[index];
+
+        if (ionshared::util::hasValue(occurrence.temporary)) {
+            return occurrence.temporary;
+        }
+
+        ionshared::Ptr<Type> type = findType(occurrence.expression->rawCast<Expression>());
+        std::optional<size_t> orderIndex = block->locate(occurrence.anchor->staticCast<Statement>());
+
+        if (type == nullptr || !orderIndex.has_value()) {
+            return std::nullopt;
+        }
+
+        std::string name;
+
+        do {
+            name = "cse." + std::to_string(this->temporaryCount++);
+        }
+        while (isDeclared(block, name));
+
+        ionshared::Ptr<VariableDeclStatement> temporary =
+            std::make_shared<VariableDeclStatement>(VariableDeclStatementOpts{
+                block->staticCast<Block>(),
+                type,
+                name,
+                occurrence.expression
+            });
+
+        if (!occurrence.owner->replaceChild(
+            occurrence.expression.get(),
+            this->createTemporaryRef(block, temporary)
+        )) {
+            return std::nullopt;
+        }
+
+        block->insertStatements(*orderIndex, {temporary});
+
+        // The expressions enclosing the occurrence now refer to the temporary instead.
+        CommonSubexpressionEliminationPass::invalidate(table, occurrence.enclosingIndex);
+
+        Statement *previousAnchor = occurrence.anchor;
+
+        occurrence.owner = temporary.get();
+        occurrence.anchor = temporary.get();
+        occurrence.enclosingIndex = std::nullopt;
+        occurrence.temporary = temporary;
+
+        // Occurrences nested within the expression are now evaluated by the temporary.
+        for (size_t i = index + 1; i < table.occurrences.size(); i++) {
+            Occurrence &nestedOccurrence = table.occurrences[i];
+
+            if (nestedOccurrence.anchor != previousAnchor) {
+                continue;
+            }
+
+            std::optional<size_t> enclosingIndex = nestedOccurrence.enclosingIndex;
+
+            while (enclosingIndex.has_value() && *enclosingIndex != index) {
+                enclosingIndex = table.occurrences[*enclosingIndex].enclosingIndex;
+            }
+
+            if (enclosingIndex.has_value()) {
+                nestedOccurrence.anchor = temporary.get();
+            }
+        }
+
+        return temporary;
+    }
+
+    void CommonSubexpressionEliminationPass::eliminate(
+        Block *block,
+        OccurrenceTable &table,
+        Construct *owner,
+        const ionshared::Ptr<Construct> &value,
+        Statement *anchor,
+        std::optional<size_t> enclosingIndex
+    ) {
+        std::optional<size_t> index = std::nullopt;
+
+        if (this->isCandidate(value.get())) {
+            Reads reads = {};
+            std::optional<size_t> hash = this->hashExpression(value.get(), reads);
+
+            if (hash.has_value()) {
+                auto [begin, end] = table.buckets.equal_range(*hash);
+
+                for (auto bucket = begin; bucket != end; bucket++) {
+                    size_t candidateIndex = bucket->second;
+
+                    if (!table.occurrences[candidateIndex].isAvailable
+                        || !CommonSubexpressionEliminationPass::isEqual(
+                            table.occurrences[candidateIndex].expression.get(),
+                            value.get()
+                        )) {
+                        continue;
+                    }
+
+                    ionshared::OptPtr<VariableDeclStatement> temporary =
+                        this->materialize(block, table, candidateIndex);
+
+                    if (!ionshared::util::hasValue(temporary)
+                        || !owner->replaceChild(value.get(), this->createTemporaryRef(block, *temporary))) {
+                        break;
+                    }
+
+                    CommonSubexpressionEliminationPass::invalidate(table, enclosingIndex);
+                    this->eliminatedExpressionCount++;
+
+                    return;
+                }
+
+                index = table.occurrences.size();
+
+                table.occurrences.push_back(Occurrence{
+                    owner,
+                    value,
+                    anchor,
+                    enclosingIndex,
+                    std::move(reads),
+                    std::nullopt,
+                    true
+                });
+
+                table.buckets.emplace(*hash, *index);
+            }
+        }
+
+        std::vector<ionshared::Ptr<Construct>> children = {};
+
+        value->forEachChild([&children](Construct *child) {
+            // Blocks are processed on their own, and references are not values.
+            if (child->constructKind != ConstructKind::Block && child->constructKind != ConstructKind::Ref) {
+                children.push_back(child->nativeCast());
+            }
+        });
+
+        for (const auto &child : children) {
+            this->eliminate(block, table, value.get(), child, anchor, index.has_value() ? index : enclosingIndex);
+        }
+    }
+
+    void CommonSubexpressionEliminationPass::eliminateBlock(Block *block) {
+        OccurrenceTable table = OccurrenceTable{};
+
+        // Temporaries inserted along the way need not be processed.
+        std::vector<ionshared::Ptr<Statement>> statements = block->statements;
+
+        for (const auto &statement : statements) {
+            switch (statement->statementKind) {
+                case StatementKind::If: {
+                    auto ifStatement = statement->rawCast<IfStatement>();
+
+                    this->eliminate(
+                        block,
+                        table,
+                        ifStatement,
+                        ifStatement->condition,
+                        ifStatement,
+                        std::nullopt
+                    );
+
+                    break;
+                }
+
+                case StatementKind::BlockWrapper: {
+                    break;
+                }
+
+                default: {
+                    std::vector<ionshared::Ptr<Construct>> children = {};
+
+                    statement->forEachChild([&children](Construct *child) {
+                        if (child->constructKind != ConstructKind::Ref) {
+                            children.push_back(child->nativeCast());
+                        }
+                    });
+
+                    for (const auto &child : children) {
+                        this->eliminate(block, table, statement.get(), child, statement.get(), std::nullopt);
+                    }
+
+                    break;
+                }
+            }
+
+            // Values computed beforehand are stale once the locals they read are assigned.
+            if (statement->statementKind == StatementKind::Assignment
+                || statement->statementKind == StatementKind::If
+                || statement->statementKind == StatementKind::BlockWrapper) {
+                Reads assignments = {};
+
+                CommonSubexpressionEliminationPass::kill(
+                    table,
+                    CommonSubexpressionEliminationPass::collectAssignments(statement.get(), assignments)
+                        ? std::make_optional(std::move(assignments))
+                        : std::nullopt
+                );
+            }
+        }
+    }
+
+    CommonSubexpressionEliminationPass::CommonSubexpressionEliminationPass(
+        ionshared::Ptr<ionshared::PassContext> context
+    ) :
+        Pass(std::move(context)),
+        eliminatedExpressionCount(0),
+        temporaryCount(0),
+        effectSummary(nullptr) {
+        //
+    }
+
+    bool CommonSubexpressionEliminationPass::isFusible() const {
+        return true;
+    }
+
+    std::string_view CommonSubexpressionEliminationPass::getPassName() const {
+        return "CommonSubexpressionEliminationPass";
+    }
+
+    void CommonSubexpressionEliminationPass::visitModule(Module *node) {
+        this->effectSummary = this->requireAnalysisManager()->get<EffectAnalysis>(node);
+    }
+
+    void CommonSubexpressionEliminationPass::afterVisitChildren(Construct *node) {
+        if (node->constructKind == ConstructKind::Block) {
+            this->eliminateBlock(node->rawCast<Block>());
+        }
+    }
+
+    uint64_t CommonSubexpressionEliminationPass::getEliminatedExpressionCount() const noexcept {
+        return this->eliminatedExpressionCount;
+    }
+}
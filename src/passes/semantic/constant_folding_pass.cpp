@@ -0,0 +1,64 @@
+#include <ionlang/passes/semantic/constant_folding_pass.h>
+
+namespace ionlang {
+    ionshared::Ptr<Construct> ConstantFoldingPass::rewrite(Construct *node) {
+        if (node->constructKind != ConstructKind::Value
+            || node->rawCast<Value<>>()->getValueKind() != ValueKind::Expression) {
+            return nullptr;
+        }
+
+        std::optional<EvaluationResult> result = ConstantEvaluator::evaluate(node->rawCast<Expression>());
+
+        if (!result.has_value()) {
+            return nullptr;
+        }
+
+        switch (result->status) {
+            case EvaluationStatus::Overflow: {
+                this->report(diagnostic::semanticConstantOverflow, node->sourceLocation);
+
+                break;
+            }
+
+            case EvaluationStatus::DivisionByZero: {
+                this->report(diagnostic::semanticDivisionByZero, node->sourceLocation);
+
+                return nullptr;
+            }
+
+            case EvaluationStatus::Unsupported: {
+                return nullptr;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        ionshared::Ptr<Construct> literal =
+            ConstantEvaluator::makeLiteral(*result->value, node->findTypeContext());
+
+        literal->sourceLocation = node->sourceLocation;
+
+        return literal;
+    }
+
+    ConstantFoldingPass::ConstantFoldingPass(
+        ionshared::Ptr<ionshared::PassContext> context
+    ) :
+        RewritePass(std::move(context), PassScope::Function) {
+        //
+    }
+
+    ionshared::Ptr<Pass> ConstantFoldingPass::clone() const {
+        return std::make_shared<ConstantFoldingPass>(this->context);
+    }
+
+    bool ConstantFoldingPass::isFusible() const {
+        return true;
+    }
+
+    std::string_view ConstantFoldingPass::getPassName() const {
+        return "ConstantFoldingPass";
+    }
+}
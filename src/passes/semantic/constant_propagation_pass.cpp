@@ -0,0 +1,306 @@
+#include <ionlang/passes/semantic/constant_propagation_pass.h>
+
+namespace ionlang {
+    ConstantPropagationPass::Environment ConstantPropagationPass::merge(
+        const Environment &first,
+        const Environment &second
+    ) {
+        Environment result = {};
+
+        for (const auto &[variableDecl, constant] : first) {
+            auto entry = second.find(variableDecl);
+
+            if (entry != second.end() && ConstantEvaluator::isEqual(constant, entry->second)) {
+                result.emplace(variableDecl, constant);
+            }
+        }
+
+        return result;
+    }
+
+    ionshared::Ptr<Construct> ConstantPropagationPass::substitute(
+        Construct *value,
+        const Environment &environment
+    ) {
+        if (value == nullptr
+            || value->constructKind != ConstructKind::Value
+            || value->rawCast<Value<>>()->getValueKind() != ValueKind::Expression) {
+            return nullptr;
+        }
+
+        Expression *expression = value->rawCast<Expression>();
+        ionshared::Ptr<Construct> literal = nullptr;
+
+        if (expression->expressionKind == ExpressionKind::VariableRef) {
+            PtrRef<VariableDeclStatement> variableDeclRef =
+                expression->rawCast<VariableRefExpr>()->getVariableDecl();
+
+            if (variableDeclRef == nullptr || !variableDeclRef->isResolved()) {
+                return nullptr;
+            }
+
+            auto entry = environment.find(variableDeclRef->value->get());
+
+            if (entry == environment.end()) {
+                return nullptr;
+            }
+
+            this->substitutionCount++;
+            literal = ConstantEvaluator::makeLiteral(entry->second, expression->findTypeContext());
+        }
+        else {
+            std::vector<Construct *> operands = {};
+
+            // Collect the operands first, as replacing them invalidates the iteration.
+            expression->forEachChild([&operands](Construct *operand) {
+                operands.push_back(operand);
+            });
+
+            for (Construct *operand : operands) {
+                ionshared::Ptr<Construct> replacement = this->substitute(operand, environment);
+
+                if (replacement != nullptr) {
+                    expression->replaceChild(operand, std::move(replacement));
+                }
+            }
+
+            std::optional<EvaluationResult> result = ConstantEvaluator::evaluate(expression);
+
+            // Overflows and divisions by zero are reported by constant folding.
+            if (!result.has_value() || result->status != EvaluationStatus::Success) {
+                return nullptr;
+            }
+
+            literal = ConstantEvaluator::makeLiteral(*result->value, expression->findTypeContext());
+        }
+
+        literal->sourceLocation = value->sourceLocation;
+
+        return literal;
+    }
+
+    std::optional<Constant> ConstantPropagationPass::propagateInto(
+        Construct *owner,
+        Construct *child,
+        const Environment &environment
+    ) {
+        ionshared::Ptr<Construct> replacement = this->substitute(child, environment);
+
+        if (replacement == nullptr) {
+            return ConstantEvaluator::findConstant(child);
+        }
+
+        std::optional<Constant> constant = ConstantEvaluator::findConstant(replacement.get());
+
+        // The value is known even if the slot cannot hold a literal.
+        owner->replaceChild(child, std::move(replacement));
+
+        return constant;
+    }
+
+    bool ConstantPropagationPass::propagateBlock(Block *block, Environment &environment) {
+        size_t orderIndex = 0;
+
+        while (orderIndex < block->statements.size()) {
+            // Keep the statement alive, in case it is replaced.
+            ionshared::Ptr<Statement> statement = block->statements[orderIndex];
+
+            switch (statement->statementKind) {
+                case StatementKind::VariableDeclaration: {
+                    VariableDeclStatement *variableDecl = statement->rawCast<VariableDeclStatement>();
+
+                    std::optional<Constant> value = variableDecl->value == nullptr
+                        ? std::nullopt
+                        : this->propagateInto(variableDecl, variableDecl->value.get(), environment);
+
+                    if (value.has_value()) {
+                        environment.insert_or_assign(variableDecl, *value);
+                    }
+                    else {
+                        environment.erase(variableDecl);
+                    }
+
+                    break;
+                }
+
+                case StatementKind::Assignment: {
+                    AssignmentStatement *assignment = statement->rawCast<AssignmentStatement>();
+
+                    std::optional<Constant> value = assignment->value == nullptr
+                        ? std::nullopt
+                        : this->propagateInto(assignment, assignment->value.get(), environment);
+
+                    PtrRef<VariableDeclStatement> variableDeclRef =
+                        assignment->variableDeclStatementRef;
+
+                    // Any of the locals might have been assigned.
+                    if (variableDeclRef == nullptr || !variableDeclRef->isResolved()) {
+                        environment.clear();
+                    }
+                    else if (value.has_value()) {
+                        environment.insert_or_assign(variableDeclRef->value->get(), *value);
+                    }
+                    else {
+                        environment.erase(variableDeclRef->value->get());
+                    }
+
+                    break;
+                }
+
+                case StatementKind::Return: {
+                    ReturnStatement *returnStatement = statement->rawCast<ReturnStatement>();
+
+                    if (returnStatement->hasValue()) {
+                        this->propagateInto(returnStatement, returnStatement->value->get(), environment);
+                    }
+
+                    // Any statements afterwards are unreachable.
+                    return false;
+                }
+
+                case StatementKind::ExprWrapper: {
+                    ExprWrapperStatement *exprWrapper = statement->rawCast<ExprWrapperStatement>();
+
+                    this->propagateInto(exprWrapper, exprWrapper->getExpression().get(), environment);
+
+                    break;
+                }
+
+                case StatementKind::BlockWrapper: {
+                    if (!this->propagateBlock(statement->rawCast<BlockWrapperStatement>()->block.get(), environment)) {
+                        return false;
+                    }
+
+                    break;
+                }
+
+                case StatementKind::If: {
+                    if (!this->propagateIfStatement(block, orderIndex, environment)) {
+                        return false;
+                    }
+
+                    break;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            /**
+             * A statement which was replaced or removed was not propagated
+             * through yet; its replacement (or its successor) is at the
+             * same position.
+             */
+            if (orderIndex < block->statements.size() && block->statements[orderIndex] != statement) {
+                continue;
+            }
+
+            orderIndex++;
+        }
+
+        return true;
+    }
+
+    bool ConstantPropagationPass::propagateIfStatement(
+        Block *block,
+        size_t orderIndex,
+        Environment &environment
+    ) {
+        IfStatement *ifStatement = block->statements[orderIndex]->rawCast<IfStatement>();
+
+        std::optional<Constant> condition =
+            this->propagateInto(ifStatement, ifStatement->condition.get(), environment);
+
+        if (condition.has_value() && std::holds_alternative<bool>(*condition)) {
+            ionshared::OptPtr<Block> takenBlock = std::get<bool>(*condition)
+                ? ifStatement->consequentBlock
+                : ifStatement->alternativeBlock;
+
+            this->prunedBranchCount++;
+
+            if (!ionshared::util::hasValue(takenBlock)) {
+                block->removeStatements(orderIndex, orderIndex + 1);
+
+                return true;
+            }
+
+            // Keep the taken block's scope, as its locals might shadow others.
+            ionshared::Ptr<BlockWrapperStatement> blockWrapper =
+                std::make_shared<BlockWrapperStatement>(BlockWrapperStatementOpts{
+                    block->staticCast<Block>(),
+                    *takenBlock
+                });
+
+            takenBlock->get()->parent = blockWrapper;
+            block->replaceChild(ifStatement, blockWrapper);
+
+            return true;
+        }
+
+        Environment alternativeEnvironment = environment;
+
+        bool isConsequentReachable =
+            this->propagateBlock(ifStatement->consequentBlock.get(), environment);
+
+        bool isAlternativeReachable = !ifStatement->hasAlternativeBlock()
+            || this->propagateBlock(ifStatement->alternativeBlock->get(), alternativeEnvironment);
+
+        // Only values flowing out of reachable branches are seen afterwards.
+        if (!isConsequentReachable) {
+            environment = std::move(alternativeEnvironment);
+        }
+        else if (isAlternativeReachable) {
+            environment = ConstantPropagationPass::merge(environment, alternativeEnvironment);
+        }
+
+        return isConsequentReachable || isAlternativeReachable;
+    }
+
+    ConstantPropagationPass::ConstantPropagationPass(
+        ionshared::Ptr<ionshared::PassContext> context
+    ) :
+        Pass(std::move(context), PassScope::Function),
+        substitutionCount(0),
+        prunedBranchCount(0) {
+        //
+    }
+
+    ionshared::Ptr<Pass> ConstantPropagationPass::clone() const {
+        return std::make_shared<ConstantPropagationPass>(this->context);
+    }
+
+    void ConstantPropagationPass::mergeStatistics(const Pass &clone) {
+        const auto &other = static_cast<const ConstantPropagationPass &>(clone);
+
+        Pass::mergeStatistics(clone);
+        this->substitutionCount += other.substitutionCount;
+        this->prunedBranchCount += other.prunedBranchCount;
+    }
+
+    std::string_view ConstantPropagationPass::getPassName() const {
+        return "ConstantPropagationPass";
+    }
+
+    void ConstantPropagationPass::visitFunction(Function *node) {
+        if (node->body == nullptr) {
+            return;
+        }
+
+        Environment environment = {};
+
+        this->propagateBlock(node->body.get(), environment);
+    }
+
+    bool ConstantPropagationPass::shouldVisitChildren(Construct *node) {
+        return node->constructKind != ConstructKind::Function;
+    }
+
+    uint64_t ConstantPropagationPass::getSubstitutionCount() const noexcept {
+        return this->substitutionCount;
+    }
+
+    uint64_t ConstantPropagationPass::getPrunedBranchCount() const noexcept {
+        return this->prunedBranchCount;
+    }
+}
@@ -0,0 +1,316 @@
+#include <ionlang/misc/construct_cloner.h>
+#include <ionlang/misc/util.h>
+#include <ionlang/passes/semantic/inlining_pass.h>
+
+namespace ionlang {
+    size_t InliningPass::estimateSize(Function *function) {
+        size_t size = 0;
+        std::vector<Construct *> stack = {function->body.get()};
+
+        while (!stack.empty()) {
+            Construct *construct = stack.back();
+
+            stack.pop_back();
+            size++;
+
+            construct->forEachChild([&stack](Construct *child) {
+                stack.push_back(child);
+            });
+        }
+
+        return size;
+    }
+
+    bool InliningPass::isInlinable(Function *function) {
+        ionshared::Ptr<Args> args = function->prototype->args;
+
+        if (args->isVariable) {
+            return false;
+        }
+
+        const std::vector<ionshared::Ptr<Statement>> &statements = function->body->statements;
+        Construct *lastStatement = statements.empty() ? nullptr : statements.back().get();
+        std::vector<Construct *> stack = {function->body.get()};
+
+        while (!stack.empty()) {
+            Construct *construct = stack.back();
+
+            stack.pop_back();
+
+            if (construct->constructKind == ConstructKind::Statement
+                && construct->rawCast<Statement>()->statementKind == StatementKind::Return
+                && construct != lastStatement) {
+                return false;
+            }
+            else if (construct->constructKind == ConstructKind::Ref) {
+                auto ref = construct->rawCast<Ref<>>();
+
+                if (!ref->isResolved()
+                    && (ref->refKind != RefKind::Variable || !args->items->contains(ref->name))) {
+                    return false;
+                }
+            }
+
+            construct->forEachChild([&stack](Construct *child) {
+                stack.push_back(child);
+            });
+        }
+
+        return true;
+    }
+
+    CallExpr *InliningPass::findTopLevelCall(Statement *statement) {
+        Construct *value;
+
+        switch (statement->statementKind) {
+            case StatementKind::ExprWrapper: {
+                value = statement->rawCast<ExprWrapperStatement>()->getExpression().get();
+
+                break;
+            }
+
+            case StatementKind::VariableDeclaration: {
+                value = statement->rawCast<VariableDeclStatement>()->value.get();
+
+                break;
+            }
+
+            case StatementKind::Assignment: {
+                value = statement->rawCast<AssignmentStatement>()->value.get();
+
+                break;
+            }
+
+            case StatementKind::Return: {
+                auto returnStatement = statement->rawCast<ReturnStatement>();
+
+                value = returnStatement->hasValue() ? returnStatement->value->get() : nullptr;
+
+                break;
+            }
+
+            case StatementKind::If: {
+                // The condition is evaluated before either branch is taken.
+                value = statement->rawCast<IfStatement>()->condition.get();
+
+                break;
+            }
+
+            default: {
+                return nullptr;
+            }
+        }
+
+        if (value == nullptr
+            || value->constructKind != ConstructKind::Value
+            || value->rawCast<Value<>>()->getValueKind() != ValueKind::Expression
+            || value->rawCast<Expression>()->expressionKind != ExpressionKind::Call) {
+            return nullptr;
+        }
+
+        return value->rawCast<CallExpr>();
+    }
+
+    Function *InliningPass::findInlinableCallee(
+        CallExpr *callExpr,
+        Function *caller,
+        const CallGraph &callGraph
+    ) const {
+        if (!callExpr->calleeRef->isResolved()) {
+            return nullptr;
+        }
+
+        Construct *target = callExpr->calleeRef->value->get();
+
+        if (target == caller || target->constructKind != ConstructKind::Function) {
+            return nullptr;
+        }
+
+        auto callee = target->rawCast<Function>();
+
+        if (callee->hasAttribute(InliningPass::noInlineAttributeName)
+            || callGraph.isRecursive(callee)
+            || callExpr->args.size() != callee->prototype->args->items->getSize()
+            || !InliningPass::isInlinable(callee)) {
+            return nullptr;
+        }
+
+        bool isForced = callee->hasAttribute(InliningPass::inlineAttributeName);
+
+        return isForced || InliningPass::estimateSize(callee) <= this->sizeThreshold
+            ? callee
+            : nullptr;
+    }
+
+    std::optional<size_t> InliningPass::inlineCall(
+        Block *block,
+        size_t orderIndex,
+        CallExpr *callExpr,
+        Function *callee
+    ) {
+        ionshared::Ptr<Block> target = block->staticCast<Block>();
+        ionshared::Ptr<Statement> statement = block->statements[orderIndex];
+        std::string suffix = ".inline" + std::to_string(this->nameCounter++);
+
+        ConstructCloner::Renamer renamer = [&suffix](const std::string &name) {
+            return name + suffix;
+        };
+
+        ConstructCloner cloner = ConstructCloner(renamer);
+        std::vector<ionshared::Ptr<Statement>> statements = {};
+        size_t argumentIndex = 0;
+
+        /**
+         * Bind each argument to a local standing in for the parameter at
+         * the same position. The locals are declared in order, therefore
+         * the arguments are still evaluated from left to right.
+         */
+        callee->prototype->args->items->forEach([&](const std::string &id, const Arg &parameter) {
+            ionshared::Ptr<VariableDeclStatement> parameterDecl =
+                std::make_shared<VariableDeclStatement>(VariableDeclStatementOpts{
+                    target,
+                    parameter.first,
+                    renamer(parameter.second),
+                    callExpr->args[argumentIndex++]
+                });
+
+            cloner.bind(parameter.second, parameterDecl);
+            statements.push_back(parameterDecl);
+        });
+
+        const std::vector<ionshared::Ptr<Statement>> &bodyStatements = callee->body->statements;
+        ionshared::Ptr<Construct> result = nullptr;
+
+        for (size_t i = 0; i < bodyStatements.size(); i++) {
+            Statement *bodyStatement = bodyStatements[i].get();
+
+            // The final return provides the value of the call.
+            if (i + 1 == bodyStatements.size() && bodyStatement->statementKind == StatementKind::Return) {
+                auto returnStatement = bodyStatement->rawCast<ReturnStatement>();
+
+                if (returnStatement->hasValue()) {
+                    result = cloner.cloneValue(returnStatement->value->get(), target);
+
+                    if (result == nullptr) {
+                        return std::nullopt;
+                    }
+                }
+
+                break;
+            }
+
+            ionshared::Ptr<Statement> statementCopy = cloner.cloneStatement(bodyStatement, target);
+
+            if (statementCopy == nullptr) {
+                return std::nullopt;
+            }
+
+            statements.push_back(statementCopy);
+        }
+
+        size_t next = orderIndex + statements.size();
+
+        // The value of the call is discarded, and has no side effects of its own.
+        if (statement->statementKind == StatementKind::ExprWrapper
+            && (result == nullptr || !util::hasCall(result.get()))) {
+            block->removeStatements(orderIndex, orderIndex + 1);
+        }
+        else if (result == nullptr || !statement->replaceChild(callExpr, result)) {
+            return std::nullopt;
+        }
+        else {
+            next++;
+        }
+
+        block->insertStatements(orderIndex, statements);
+        this->inlinedCallCount++;
+
+        return next;
+    }
+
+    void InliningPass::inlineBlock(Block *block, Function *caller, const CallGraph &callGraph) {
+        size_t orderIndex = 0;
+
+        while (orderIndex < block->statements.size()) {
+            ionshared::Ptr<Statement> statement = block->statements[orderIndex];
+
+            switch (statement->statementKind) {
+                case StatementKind::If: {
+                    auto ifStatement = statement->rawCast<IfStatement>();
+
+                    this->inlineBlock(ifStatement->consequentBlock.get(), caller, callGraph);
+
+                    if (ifStatement->hasAlternativeBlock()) {
+                        this->inlineBlock(ifStatement->alternativeBlock->get(), caller, callGraph);
+                    }
+
+                    break;
+                }
+
+                case StatementKind::BlockWrapper: {
+                    this->inlineBlock(
+                        statement->rawCast<BlockWrapperStatement>()->block.get(),
+                        caller,
+                        callGraph
+                    );
+
+                    break;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            CallExpr *callExpr = InliningPass::findTopLevelCall(statement.get());
+
+            Function *callee = callExpr != nullptr
+                ? this->findInlinableCallee(callExpr, caller, callGraph)
+                : nullptr;
+
+            std::optional<size_t> next = callee != nullptr
+                ? this->inlineCall(block, orderIndex, callExpr, callee)
+                : std::nullopt;
+
+            // Calls within the inlined statements are not revisited.
+            orderIndex = next.value_or(orderIndex + 1);
+        }
+    }
+
+    InliningPass::InliningPass(
+        ionshared::Ptr<ionshared::PassContext> context,
+        uint32_t sizeThreshold
+    ) :
+        Pass(std::move(context)),
+        sizeThreshold(sizeThreshold),
+        inlinedCallCount(0),
+        nameCounter(0) {
+        //
+    }
+
+    std::string_view InliningPass::getPassName() const {
+        return "InliningPass";
+    }
+
+    void InliningPass::visitModule(Module *node) {
+        std::shared_ptr<const CallGraph> callGraph =
+            this->requireAnalysisManager()->get<CallGraphAnalysis>(node);
+
+        // Callees are processed first, so that their copies are already simplified.
+        for (Construct *construct : callGraph->getBottomUpOrder()) {
+            if (construct->constructKind == ConstructKind::Function) {
+                auto function = construct->rawCast<Function>();
+
+                this->inlineBlock(function->body.get(), function, *callGraph);
+            }
+        }
+    }
+
+    bool InliningPass::shouldVisitChildren(Construct *node) {
+        return node->constructKind != ConstructKind::Module;
+    }
+
+    uint64_t InliningPass::getInlinedCallCount() const noexcept {
+        return this->inlinedCallCount;
+    }
+}
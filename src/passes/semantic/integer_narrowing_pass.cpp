@@ -0,0 +1,541 @@
+#include <functional>
+#include <unordered_set>
+#include <ionlang/passes/pass.h>
+#include <ionlang/misc/util.h>
+#include <ionlang/type_system/type_context.h>
+#include <ionlang/passes/semantic/integer_narrowing_pass.h>
+
+namespace ionlang {
+    static bool isInteger64(const ionshared::Ptr<Type> &type) {
+        return type != nullptr
+            && type->typeKind == TypeKind::Integer
+            && type->staticCast<IntegerType>()->integerKind == IntegerKind::Int64;
+    }
+
+    Construct *IntegerNarrowingPass::Webs::find(Construct *construct) {
+        auto representative = this->representatives.find(construct);
+
+        if (representative == this->representatives.end()) {
+            this->representatives[construct] = construct;
+
+            return construct;
+        }
+        else if (representative->second == construct) {
+            return construct;
+        }
+
+        Construct *root = this->find(representative->second);
+
+        // Compress the path, so that later lookups are direct.
+        this->representatives[construct] = root;
+
+        return root;
+    }
+
+    void IntegerNarrowingPass::Webs::join(Construct *first, Construct *second) {
+        Construct *firstRoot = this->find(first);
+        Construct *secondRoot = this->find(second);
+
+        if (firstRoot != secondRoot) {
+            this->representatives[secondRoot] = firstRoot;
+        }
+    }
+
+    bool IntegerNarrowingPass::isNarrowable(Construct *construct) {
+        if (construct->constructKind == ConstructKind::Statement) {
+            return construct->rawCast<Statement>()->statementKind == StatementKind::VariableDeclaration
+                && isInteger64(construct->rawCast<VariableDeclStatement>()->type);
+        }
+        else if (construct->constructKind != ConstructKind::Value) {
+            return false;
+        }
+
+        switch (construct->rawCast<Value<>>()->getValueKind()) {
+            case ValueKind::Integer: {
+                return isInteger64(construct->rawCast<IntegerLiteral>()->type);
+            }
+
+            case ValueKind::Expression: {
+                break;
+            }
+
+            default: {
+                return false;
+            }
+        }
+
+        auto expression = construct->rawCast<Expression>();
+
+        switch (expression->expressionKind) {
+            case ExpressionKind::VariableRef: {
+                PtrRef<VariableDeclStatement> variableDeclRef =
+                    construct->rawCast<VariableRefExpr>()->getVariableDecl();
+
+                return variableDeclRef->isResolved() && isInteger64(variableDeclRef->value->get()->type);
+            }
+
+            case ExpressionKind::UnaryOperation: {
+                Operator operation = construct->rawCast<UnaryOperation>()->getOperator();
+
+                return isInteger64(expression->type)
+                    && (operation == Operator::Addition || operation == Operator::Subtraction);
+            }
+
+            case ExpressionKind::BinaryOperation: {
+                auto binaryOperation = construct->rawCast<BinaryOperation>();
+
+                // Shifts and exponents behave differently once narrowed.
+                switch (binaryOperation->getOperator()) {
+                    case Operator::Addition:
+                    case Operator::Subtraction:
+                    case Operator::Multiplication:
+                    case Operator::Division:
+                    case Operator::Modulo:
+                    case Operator::BitwiseAnd: {
+                        return isInteger64(expression->type) && binaryOperation->hasRightSide();
+                    }
+
+                    default: {
+                        return false;
+                    }
+                }
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    ionshared::Ptr<Construct> IntegerNarrowingPass::retype(
+        Construct *value,
+        const ionshared::Ptr<IntegerType> &type
+    ) {
+        ionshared::Ptr<Construct> copy;
+
+        if (value->rawCast<Value<>>()->getValueKind() == ValueKind::Integer) {
+            copy = std::make_shared<IntegerLiteral>(type, value->rawCast<IntegerLiteral>()->value);
+        }
+        else {
+            switch (value->rawCast<Expression>()->expressionKind) {
+                case ExpressionKind::UnaryOperation: {
+                    auto unaryOperation = value->rawCast<UnaryOperation>();
+
+                    copy = std::make_shared<UnaryOperation>(
+                        type,
+                        unaryOperation->getOperator(),
+                        IntegerNarrowingPass::retype(unaryOperation->getValue().get(), type)
+                    );
+
+                    break;
+                }
+
+                case ExpressionKind::BinaryOperation: {
+                    auto binaryOperation = value->rawCast<BinaryOperation>();
+
+                    copy = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+                        type,
+                        binaryOperation->getOperator(),
+                        IntegerNarrowingPass::retype(binaryOperation->getLeftSide().get(), type),
+                        IntegerNarrowingPass::retype(binaryOperation->getRightSide()->get(), type)
+                    });
+
+                    break;
+                }
+
+                // References take on the type of their variable.
+                default: {
+                    return value->nativeCast();
+                }
+            }
+        }
+
+        copy->sourceLocation = value->sourceLocation;
+
+        return copy;
+    }
+
+    void IntegerNarrowingPass::foldComparisons(Function *function, const IntegerRanges &integerRanges) {
+        ionshared::Ptr<TypeContext> typeContext = function->findTypeContext();
+        std::vector<std::pair<Construct *, Construct *>> stack = {};
+
+        function->body->forEachChild([&stack, &function](Construct *child) {
+            stack.emplace_back(function->body.get(), child);
+        });
+
+        while (!stack.empty()) {
+            auto [owner, construct] = stack.back();
+
+            stack.pop_back();
+
+            if (construct->constructKind == ConstructKind::Value
+                && construct->rawCast<Value<>>()->getValueKind() == ValueKind::Expression
+                && construct->rawCast<Expression>()->expressionKind == ExpressionKind::BinaryOperation) {
+                auto binaryOperation = construct->rawCast<BinaryOperation>();
+                Operator operation = binaryOperation->getOperator();
+
+                std::optional<IntegerRange> leftSide = integerRanges.findRange(binaryOperation->getLeftSide().get());
+
+                std::optional<IntegerRange> rightSide = binaryOperation->hasRightSide()
+                    ? integerRanges.findRange(binaryOperation->getRightSide()->get())
+                    : std::nullopt;
+
+                std::optional<bool> result = std::nullopt;
+
+                if (leftSide.has_value() && rightSide.has_value() && !util::hasCall(binaryOperation)) {
+                    if (operation == Operator::LessThan && (leftSide->max < rightSide->min || leftSide->min >= rightSide->max)) {
+                        result = leftSide->max < rightSide->min;
+                    }
+                    else if (operation == Operator::GreaterThan && (leftSide->min > rightSide->max || leftSide->max <= rightSide->min)) {
+                        result = leftSide->min > rightSide->max;
+                    }
+                }
+
+                if (result.has_value()) {
+                    ionshared::Ptr<BooleanLiteral> booleanLiteral =
+                        std::make_shared<BooleanLiteral>(*result, typeContext->getBooleanType());
+
+                    booleanLiteral->sourceLocation = construct->sourceLocation;
+
+                    if (owner->replaceChild(construct, booleanLiteral)) {
+                        this->foldedComparisonCount++;
+
+                        continue;
+                    }
+                }
+            }
+
+            construct->forEachChild([&stack, construct = construct](Construct *child) {
+                stack.emplace_back(construct, child);
+            });
+        }
+    }
+
+    void IntegerNarrowingPass::narrowVariables(Function *function, const IntegerRanges &integerRanges) {
+        ionshared::Ptr<TypeContext> typeContext = function->findTypeContext();
+        Webs webs = Webs();
+        std::vector<Construct *> escapes = {};
+
+        auto escape = [&](Construct *construct) {
+            if (IntegerNarrowingPass::isNarrowable(construct)) {
+                escapes.push_back(construct);
+            }
+        };
+
+        // Values of different types may not be mixed, thus both must be narrowed or neither.
+        auto link = [&](Construct *first, Construct *second) {
+            bool isFirstNarrowable = IntegerNarrowingPass::isNarrowable(first);
+            bool isSecondNarrowable = IntegerNarrowingPass::isNarrowable(second);
+
+            if (isFirstNarrowable && isSecondNarrowable) {
+                webs.join(first, second);
+            }
+            else if (isFirstNarrowable) {
+                escapes.push_back(first);
+            }
+            else if (isSecondNarrowable) {
+                escapes.push_back(second);
+            }
+        };
+
+        std::function<void(Construct *)> linkValue = [&](Construct *value) {
+            if (value->constructKind != ConstructKind::Value
+                || value->rawCast<Value<>>()->getValueKind() != ValueKind::Expression) {
+                return;
+            }
+
+            switch (value->rawCast<Expression>()->expressionKind) {
+                case ExpressionKind::VariableRef: {
+                    PtrRef<VariableDeclStatement> variableDeclRef =
+                        value->rawCast<VariableRefExpr>()->getVariableDecl();
+
+                    if (variableDeclRef->isResolved()) {
+                        link(value, variableDeclRef->value->get());
+                    }
+
+                    break;
+                }
+
+                case ExpressionKind::UnaryOperation: {
+                    Construct *operand = value->rawCast<UnaryOperation>()->getValue().get();
+
+                    link(value, operand);
+                    linkValue(operand);
+
+                    break;
+                }
+
+                case ExpressionKind::BinaryOperation: {
+                    auto binaryOperation = value->rawCast<BinaryOperation>();
+                    Construct *leftSide = binaryOperation->getLeftSide().get();
+                    Operator operation = binaryOperation->getOperator();
+
+                    linkValue(leftSide);
+
+                    if (!binaryOperation->hasRightSide()) {
+                        link(value, leftSide);
+
+                        break;
+                    }
+
+                    Construct *rightSide = binaryOperation->getRightSide()->get();
+
+                    linkValue(rightSide);
+
+                    // Comparisons yield booleans, yet their operands share a type.
+                    if (operation == Operator::LessThan || operation == Operator::GreaterThan) {
+                        link(leftSide, rightSide);
+                    }
+                    else {
+                        link(value, leftSide);
+                        link(value, rightSide);
+                    }
+
+                    break;
+                }
+
+                case ExpressionKind::Call: {
+                    for (const auto &arg : value->rawCast<CallExpr>()->args) {
+                        escape(arg.get());
+                        linkValue(arg.get());
+                    }
+
+                    break;
+                }
+
+                default: {
+                    break;
+                }
+            }
+        };
+
+        std::function<void(Block *)> linkBlock = [&](Block *block) {
+            for (const auto &statement : block->statements) {
+                switch (statement->statementKind) {
+                    case StatementKind::VariableDeclaration: {
+                        auto variableDecl = statement->rawCast<VariableDeclStatement>();
+
+                        if (IntegerNarrowingPass::isNarrowable(variableDecl)) {
+                            webs.find(variableDecl);
+                        }
+
+                        if (variableDecl->value != nullptr) {
+                            link(variableDecl, variableDecl->value.get());
+                            linkValue(variableDecl->value.get());
+                        }
+
+                        break;
+                    }
+
+                    case StatementKind::Assignment: {
+                        auto assignment = statement->rawCast<AssignmentStatement>();
+
+                        if (assignment->variableDeclStatementRef->isResolved()) {
+                            link(assignment->variableDeclStatementRef->value->get(), assignment->value.get());
+                        }
+                        else {
+                            escape(assignment->value.get());
+                        }
+
+                        linkValue(assignment->value.get());
+
+                        break;
+                    }
+
+                    case StatementKind::If: {
+                        auto ifStatement = statement->rawCast<IfStatement>();
+
+                        escape(ifStatement->condition.get());
+                        linkValue(ifStatement->condition.get());
+                        linkBlock(ifStatement->consequentBlock.get());
+
+                        if (ifStatement->hasAlternativeBlock()) {
+                            linkBlock(ifStatement->alternativeBlock->get());
+                        }
+
+                        break;
+                    }
+
+                    case StatementKind::BlockWrapper: {
+                        linkBlock(statement->rawCast<BlockWrapperStatement>()->block.get());
+
+                        break;
+                    }
+
+                    // Values returned or discarded keep their type.
+                    default: {
+                        statement->forEachChild([&](Construct *child) {
+                            escape(child);
+                            linkValue(child);
+                        });
+
+                        break;
+                    }
+                }
+            }
+        };
+
+        linkBlock(function->body.get());
+
+        std::unordered_set<Construct *> rejectedWebs = {};
+        std::unordered_map<Construct *, IntegerRange> webRanges = {};
+        std::unordered_map<Construct *, bool> webSignedness = {};
+        std::unordered_map<Construct *, ionshared::Ptr<IntegerType>> webTypes = {};
+
+        for (Construct *construct : escapes) {
+            rejectedWebs.insert(webs.find(construct));
+        }
+
+        // Collect the members first, as lookups may compress paths.
+        std::vector<Construct *> members = {};
+
+        for (const auto &[member, representative] : webs.representatives) {
+            members.push_back(member);
+        }
+
+        for (Construct *member : members) {
+            Construct *root = webs.find(member);
+            std::optional<IntegerRange> range = integerRanges.findRange(member);
+            ionshared::Ptr<Type> type;
+            bool isOperation = false;
+
+            if (member->constructKind == ConstructKind::Statement) {
+                type = member->rawCast<VariableDeclStatement>()->type;
+            }
+            else if (member->rawCast<Value<>>()->getValueKind() == ValueKind::Expression
+                && member->rawCast<Expression>()->expressionKind == ExpressionKind::VariableRef) {
+                type = member->rawCast<VariableRefExpr>()->getVariableDecl()->value->get()->type;
+            }
+            else {
+                type = member->rawCast<Value<>>()->type;
+                isOperation = member->rawCast<Value<>>()->getValueKind() == ValueKind::Expression;
+            }
+
+            bool isSigned = type->staticCast<IntegerType>()->isSigned;
+            auto signedness = webSignedness.find(root);
+
+            if (!range.has_value()
+                || (isOperation && integerRanges.mayOverflow(member))
+                || (signedness != webSignedness.end() && signedness->second != isSigned)) {
+                rejectedWebs.insert(root);
+
+                continue;
+            }
+
+            auto webRange = webRanges.find(root);
+
+            webSignedness[root] = isSigned;
+
+            webRanges[root] = webRange == webRanges.end()
+                ? *range
+                : IntegerRange{std::min(webRange->second.min, range->min), std::max(webRange->second.max, range->max)};
+        }
+
+        for (const auto &[root, range] : webRanges) {
+            if (rejectedWebs.count(root) != 0) {
+                continue;
+            }
+
+            bool isSigned = webSignedness[root];
+
+            for (const auto &candidate : {
+                typeContext->getIntegerType(IntegerKind::Int8, isSigned),
+                typeContext->getIntegerType(IntegerKind::Int16, isSigned),
+                typeContext->getIntegerType(IntegerKind::Int32, isSigned)
+            }) {
+                if (IntegerRange::findTypeRange(*candidate)->contains(range)) {
+                    webTypes[root] = candidate;
+
+                    break;
+                }
+            }
+        }
+
+        if (webTypes.empty()) {
+            return;
+        }
+
+        std::function<void(Construct *, Construct *)> narrow = [&](Construct *owner, Construct *construct) {
+            auto webType = IntegerNarrowingPass::isNarrowable(construct)
+                ? webTypes.find(webs.find(construct))
+                : webTypes.end();
+
+            if (webType != webTypes.end()) {
+                if (construct->constructKind == ConstructKind::Statement) {
+                    construct->rawCast<VariableDeclStatement>()->type = webType->second;
+                    construct->markModified();
+                    this->narrowedVariableCount++;
+                }
+                else if (construct->rawCast<Value<>>()->getValueKind() == ValueKind::Integer
+                    || construct->rawCast<Expression>()->expressionKind != ExpressionKind::VariableRef) {
+                    owner->replaceChild(construct, IntegerNarrowingPass::retype(construct, webType->second));
+
+                    return;
+                }
+            }
+
+            std::vector<Construct *> children = {};
+
+            construct->forEachChild([&children](Construct *child) {
+                if (child->constructKind != ConstructKind::Ref) {
+                    children.push_back(child);
+                }
+            });
+
+            for (Construct *child : children) {
+                narrow(construct, child);
+            }
+        };
+
+        narrow(function, function->body.get());
+    }
+
+    IntegerNarrowingPass::IntegerNarrowingPass(
+        ionshared::Ptr<ionshared::PassContext> context
+    ) :
+        Pass(std::move(context), PassScope::Function),
+        foldedComparisonCount(0),
+        narrowedVariableCount(0) {
+        //
+    }
+
+    ionshared::Ptr<Pass> IntegerNarrowingPass::clone() const {
+        return std::make_shared<IntegerNarrowingPass>(this->context);
+    }
+
+    void IntegerNarrowingPass::mergeStatistics(const Pass &clone) {
+        const auto &other = static_cast<const IntegerNarrowingPass &>(clone);
+
+        Pass::mergeStatistics(clone);
+        this->foldedComparisonCount += other.foldedComparisonCount;
+        this->narrowedVariableCount += other.narrowedVariableCount;
+    }
+
+    std::string_view IntegerNarrowingPass::getPassName() const {
+        return "IntegerNarrowingPass";
+    }
+
+    void IntegerNarrowingPass::visitFunction(Function *node) {
+        if (node->body == nullptr) {
+            return;
+        }
+
+        std::shared_ptr<const IntegerRanges> integerRanges =
+            this->requireAnalysisManager()->get<RangeAnalysis>(node);
+
+        this->foldComparisons(node, *integerRanges);
+        this->narrowVariables(node, *integerRanges);
+    }
+
+    bool IntegerNarrowingPass::shouldVisitChildren(Construct *node) {
+        return node->constructKind != ConstructKind::Function;
+    }
+
+    uint64_t IntegerNarrowingPass::getFoldedComparisonCount() const noexcept {
+        return this->foldedComparisonCount;
+    }
+
+    uint64_t IntegerNarrowingPass::getNarrowedVariableCount() const noexcept {
+        return this->narrowedVariableCount;
+    }
+}
@@ -7,4 +7,12 @@ namespace ionlang {
         Pass(std::move(context)) {
         //
     }
+
+    bool MacroExpansionPass::isFusible() const {
+        return true;
+    }
+
+    std::string_view MacroExpansionPass::getPassName() const {
+        return "MacroExpansionPass";
+    }
 }
@@ -1,74 +1,276 @@
+#include <unordered_set>
 #include <ionlang/passes/semantic/name_resolution_pass.h>
 
 namespace ionlang {
     NameResolutionPass::NameResolutionPass(
-        ionshared::Ptr<ionshared::PassContext> context
+        ionshared::Ptr<ionshared::PassContext> context,
+        PassScope passScope
     ) :
-        Pass(std::move(context)),
-        scope() {
+        Pass(std::move(context), passScope),
+        scope(),
+        bindings(),
+        undoLog(),
+        scopeMarks(),
+        undefinedRefs(),
+        drainedModule(nullptr) {
         //
     }
 
-    void NameResolutionPass::visitModule(ionshared::Ptr<Module> node) {
-        // TODO: Is it push_back() or push_front()?
-        this->scope.push_back(node->context->getGlobalScope());
+    ionshared::Ptr<Pass> NameResolutionPass::clone() const {
+        return std::make_shared<NameResolutionPass>(this->context, this->passScope);
     }
 
-    void NameResolutionPass::visitRef(PtrRef<> node) {
+    bool NameResolutionPass::isFusible() const {
+        return true;
+    }
+
+    std::string_view NameResolutionPass::getPassName() const {
+        return "NameResolutionPass";
+    }
+
+    void NameResolutionPass::resetTraversalState() {
+        this->scope.clear();
+        this->bindings.clear();
+        this->undoLog.clear();
+        this->scopeMarks.clear();
+        this->undefinedRefs.clear();
+        this->drainedModule = nullptr;
+    }
+
+    void NameResolutionPass::pushScope() {
+        this->scopeMarks.push_back(this->undoLog.size());
+    }
+
+    void NameResolutionPass::popScope() {
+        if (this->scopeMarks.empty()) {
+            throw std::runtime_error("No scope to pop");
+        }
+
+        size_t mark = this->scopeMarks.back();
+
+        this->scopeMarks.pop_back();
+
+        // Undo the scope's bindings, innermost first.
+        while (this->undoLog.size() > mark) {
+            this->undoLog.back()->pop_back();
+            this->undoLog.pop_back();
+        }
+    }
+
+    void NameResolutionPass::bind(VariableDeclStatement *variableDecl) {
+        BindingStack &bindingStack = this->bindings[variableDecl->name];
+
+        bindingStack.push_back(variableDecl);
+        this->undoLog.push_back(&bindingStack);
+    }
+
+    VariableDeclStatement *NameResolutionPass::findBinding(const std::string &name) const {
+        auto bindingStack = this->bindings.find(name);
+
+        if (bindingStack == this->bindings.end() || bindingStack->second.empty()) {
+            return nullptr;
+        }
+
+        return bindingStack->second.back();
+    }
+
+    void NameResolutionPass::reportUndefinedRef(Ref<> *ref) {
+        this->undefinedRefs.push_back(UndefinedRef{
+            ref->name,
+            ref->refKind,
+            ref->sourceLocation
+        });
+
+        this->report(diagnostic::semanticUndefinedReference, ref->sourceLocation, ref->name);
+    }
+
+    void NameResolutionPass::resolvePendingRefs(Module *module) {
+        std::vector<Function *> functions = {};
+        std::unordered_set<Function *> queuedFunctions = {};
+
+        for (const auto &construct : *module->pendingRefs) {
+            Ref<> *ref = construct->rawCast<Ref<>>();
+
+            if (ref->isResolved()) {
+                continue;
+            }
+
+            switch (ref->refKind) {
+                case RefKind::Variable: {
+                    /**
+                     * Only declarations preceding the reference are visible,
+                     * thus variables are resolved by walking the enclosing
+                     * function through the scope stack, once per function.
+                     */
+                    ionshared::Ptr<Construct> owner = ref->owner.lock();
+
+                    Function *function =
+                        owner != nullptr && owner->constructKind == ConstructKind::Block
+                            ? *this->requireAnalysisManager()->get<ParentFunctionAnalysis>(owner.get())
+                            : nullptr;
+
+                    if (function == nullptr) {
+                        this->reportUndefinedRef(ref);
+
+                        break;
+                    }
+
+                    if (queuedFunctions.insert(function).second) {
+                        functions.push_back(function);
+                    }
+
+                    break;
+                }
+
+                case RefKind::Function: {
+                    /**
+                     * The whole module was parsed by now, so functions
+                     * declared after the reference are found as well.
+                     */
+                    const ionshared::Ptr<Construct> *function =
+                        module->symbolTable->find(ref->name);
+
+                    if (function == nullptr) {
+                        this->reportUndefinedRef(ref);
+
+                        break;
+                    }
+
+                    ref->value = *function;
+
+                    break;
+                }
+
+                default: {
+                    // TODO: Better error.
+                    throw std::runtime_error("Unsupported construct kind to resolve");
+                }
+            }
+        }
+
+        for (Function *function : functions) {
+            this->traverse(function);
+        }
+
+        /**
+         * The worklist is consumed. References added later on (ex. by
+         * macro expansion) are resolved by walking the module instead.
+         */
+        module->pendingRefs = std::nullopt;
+    }
+
+    void NameResolutionPass::visitModule(Module *node) {
+        this->scope.push_back(node->symbolTable);
+        this->drainedModule = nullptr;
+
+        if (node->pendingRefs.has_value()) {
+            this->resolvePendingRefs(node);
+            this->drainedModule = node;
+        }
+    }
+
+    bool NameResolutionPass::shouldVisitChildren(Construct *node) {
+        // Modules whose worklist was just drained need not be walked.
+        return node != this->drainedModule;
+    }
+
+    void NameResolutionPass::visitBlock(Block *node) {
+        this->pushScope();
+    }
+
+    void NameResolutionPass::afterVisitChildren(Construct *node) {
+        switch (node->constructKind) {
+            case ConstructKind::Module: {
+                this->scope.pop_back();
+
+                break;
+            }
+
+            case ConstructKind::Block: {
+                this->popScope();
+
+                break;
+            }
+
+            case ConstructKind::Statement: {
+                /**
+                 * Declarations are bound once their value has been resolved,
+                 * so that the value cannot refer to the variable itself.
+                 */
+                if (node->rawCast<Statement>()->statementKind == StatementKind::VariableDeclaration) {
+                    this->bind(node->rawCast<VariableDeclStatement>());
+                }
+
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+    }
+
+    void NameResolutionPass::visitRef(Ref<> *node) {
         // Node is already resolved, no need to continue.
         if (node->isResolved()) {
             return;
         }
 
-        ionshared::Ptr<Construct> owner = node->owner;
+        ionshared::Ptr<Construct> owner = node->owner.lock();
         std::string name = node->name;
 
-        auto throwUndefinedRef = [name]{
-            throw std::runtime_error("Undefined reference to '" + name + "'");
-        };
-
         switch (node->refKind) {
             case RefKind::Variable: {
-                // TODO: Must use flow graph to find variable declarations from other blocks (remember blocks can be nested).
-
-                if (owner->constructKind != ConstructKind::Block) {
-                    // TODO: Better error.
-                    throw std::runtime_error("Cannot resolve variable declaration when owner is not a block");
-                }
-
-                auto ownerBlockSymbolTable = owner->dynamicCast<Block>()->symbolTable;
-                auto valueLookupResult = ownerBlockSymbolTable->lookup(name);
+                /**
+                 * The bindings mirror the blocks enclosing the reference,
+                 * so declarations from outer blocks are found as well,
+                 * unless shadowed.
+                 */
+                VariableDeclStatement *variableDecl = this->findBinding(name);
 
-                if (!ionshared::util::hasValue(valueLookupResult)) {
-                    throwUndefinedRef();
+                if (variableDecl == nullptr) {
+                    return this->reportUndefinedRef(node);
                 }
 
-                node->value = *valueLookupResult;
+                node->value = variableDecl->nativeCast();
 
                 break;
             }
 
             case RefKind::Function: {
-                if (owner->constructKind != ConstructKind::Block) {
+                // Prefer the module being visited, if any.
+                if (!this->scope.empty()) {
+                    std::optional<ionshared::Ptr<Construct>> lookupResult =
+                        this->scope.back()->lookup(name);
+
+                    if (!ionshared::util::hasValue(lookupResult)) {
+                        return this->reportUndefinedRef(node);
+                    }
+
+                    node->value = *lookupResult;
+
+                    break;
+                }
+                else if (owner == nullptr || owner->constructKind != ConstructKind::Block) {
                     // TODO: Better error.
                     throw std::runtime_error("Cannot resolve function reference when owner is not a block");
                 }
 
-                ionshared::OptPtr<Function> parentFunction =
-                    owner->dynamicCast<Block>()->findParentFunction();
+                Function *parentFunction =
+                    *this->requireAnalysisManager()->get<ParentFunctionAnalysis>(owner.get());
 
-                if (!ionshared::util::hasValue(parentFunction)) {
+                if (parentFunction == nullptr) {
                     // TODO: Use diagnostics.
                     throw std::runtime_error("Could not find parent function of block");
                 }
 
-                auto rootModuleSymbolTable =
-                    parentFunction->get()->getUnboxedParent()->context->getGlobalScope();
+                PtrFlatSymbolTable<Construct> rootModuleSymbolTable =
+                    parentFunction->getUnboxedParent()->symbolTable;
 
                 auto lookupResult = rootModuleSymbolTable->lookup(name);
 
                 if (!ionshared::util::hasValue(lookupResult)) {
-                    throwUndefinedRef();
+                    return this->reportUndefinedRef(node);
                 }
 
                 node->value = *lookupResult;
@@ -135,13 +337,15 @@ namespace ionlang {
 //        }
     }
 
-    void NameResolutionPass::visitScopeAnchor(ionshared::Ptr<ionshared::Scoped<Construct>> node) {
-        // TODO: ScopeStack should be pushed & popped, but its never popped.
-        // TODO: CRITICAL: Throwing SEGFAULT because node is NULL (casting fails).
-        //        this->scopeStack.add(node->getSymbolTable());
+    void NameResolutionPass::visitScopeAnchor(ionshared::Scoped<Construct> *node) {
+        // Scopes are tracked through visitBlock() and afterVisitChildren().
     }
 
-    const std::list<ionshared::PtrSymbolTable<Construct>> &NameResolutionPass::getScope() const {
+    const std::list<PtrFlatSymbolTable<Construct>> &NameResolutionPass::getScope() const {
         return this->scope;
     }
+
+    const std::vector<NameResolutionPass::UndefinedRef> &NameResolutionPass::getUndefinedRefs() const noexcept {
+        return this->undefinedRefs;
+    }
 }
@@ -0,0 +1,155 @@
+#include <ionlang/misc/util.h>
+#include <ionlang/passes/semantic/unreachable_code_elimination_pass.h>
+
+namespace ionlang {
+    UnreachableCodeEliminationPass::UnreachableCodeEliminationPass(
+        ionshared::Ptr<ionshared::PassContext> context
+    ) :
+        Pass(std::move(context), PassScope::Function),
+        removedStatementCount(0) {
+        //
+    }
+
+    ionshared::Ptr<Pass> UnreachableCodeEliminationPass::clone() const {
+        return std::make_shared<UnreachableCodeEliminationPass>(this->context);
+    }
+
+    void UnreachableCodeEliminationPass::mergeStatistics(const Pass &clone) {
+        const auto &other = static_cast<const UnreachableCodeEliminationPass &>(clone);
+
+        Pass::mergeStatistics(clone);
+        this->removedStatementCount += other.removedStatementCount;
+    }
+
+    bool UnreachableCodeEliminationPass::isDiverging(Block *block) {
+        return !block->statements.empty()
+            && UnreachableCodeEliminationPass::isDiverging(block->statements.back().get());
+    }
+
+    bool UnreachableCodeEliminationPass::isDiverging(Statement *statement) {
+        if (statement->isTerminal()) {
+            return true;
+        }
+
+        switch (statement->statementKind) {
+            case StatementKind::If: {
+                IfStatement *ifStatement = statement->rawCast<IfStatement>();
+
+                return ifStatement->hasAlternativeBlock()
+                    && UnreachableCodeEliminationPass::isDiverging(ifStatement->consequentBlock.get())
+                    && UnreachableCodeEliminationPass::isDiverging(ifStatement->alternativeBlock->get());
+            }
+
+            case StatementKind::BlockWrapper: {
+                return UnreachableCodeEliminationPass::isDiverging(
+                    statement->rawCast<BlockWrapperStatement>()->block.get()
+                );
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    void UnreachableCodeEliminationPass::removeUnreachableStatements(Block *block) {
+        std::vector<ionshared::Ptr<Statement>> terminals = block->findTerminals();
+
+        // Statements past the first terminal statement are unreachable.
+        size_t end = terminals.empty()
+            ? block->statements.size()
+            : *block->locate(terminals.front()) + 1;
+
+        // So are statements past a statement whose branches all diverge.
+        for (size_t i = 0; i < end; i++) {
+            if (UnreachableCodeEliminationPass::isDiverging(block->statements[i].get())) {
+                end = i + 1;
+
+                break;
+            }
+        }
+
+        if (end == block->statements.size()) {
+            return;
+        }
+
+        this->report(diagnostic::semanticUnreachableCode, block->statements[end]->sourceLocation);
+        this->removedStatementCount += block->removeStatements(end);
+    }
+
+    void UnreachableCodeEliminationPass::removeEmptyBranches(Block *block) {
+        size_t orderIndex = 0;
+
+        while (orderIndex < block->statements.size()) {
+            ionshared::Ptr<Statement> statement = block->statements[orderIndex];
+
+            if (statement->statementKind != StatementKind::If) {
+                orderIndex++;
+
+                continue;
+            }
+
+            IfStatement *ifStatement = statement->rawCast<IfStatement>();
+
+            if (ifStatement->hasAlternativeBlock() && ifStatement->alternativeBlock->get()->statements.empty()) {
+                ifStatement->alternativeBlock = std::nullopt;
+                ifStatement->markModified();
+            }
+
+            /**
+             * An empty consequent block may not be dropped while there is an
+             * alternative block, as the condition cannot be negated.
+             */
+            if (ifStatement->hasAlternativeBlock() || !ifStatement->consequentBlock->statements.empty()) {
+                orderIndex++;
+
+                continue;
+            }
+
+            /**
+             * Only the condition remains. Keep it as a statement of its own
+             * if evaluating it has side effects.
+             */
+            if (util::hasCall(ifStatement->condition.get())) {
+                ionshared::Ptr<Expression> condition =
+                    util::tryCastValue<Expression>(ifStatement->condition);
+
+                if (condition != nullptr) {
+                    block->replaceChild(ifStatement, std::make_shared<ExprWrapperStatement>(ExprWrapperStatementOpts{
+                        block->staticCast<Block>(),
+                        condition
+                    }));
+                }
+
+                orderIndex++;
+
+                continue;
+            }
+
+            this->removedStatementCount += block->removeStatements(orderIndex, orderIndex + 1);
+        }
+    }
+
+    bool UnreachableCodeEliminationPass::isFusible() const {
+        return true;
+    }
+
+    std::string_view UnreachableCodeEliminationPass::getPassName() const {
+        return "UnreachableCodeEliminationPass";
+    }
+
+    void UnreachableCodeEliminationPass::afterVisitChildren(Construct *node) {
+        if (node->constructKind != ConstructKind::Block) {
+            return;
+        }
+
+        Block *block = node->rawCast<Block>();
+
+        this->removeUnreachableStatements(block);
+        this->removeEmptyBranches(block);
+    }
+
+    uint64_t UnreachableCodeEliminationPass::getRemovedStatementCount() const noexcept {
+        return this->removedStatementCount;
+    }
+}
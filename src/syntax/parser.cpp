@@ -1,6 +1,7 @@
 #include <ionlang/lexical/classifier.h>
 #include <ionlang/const/notice.h>
 #include <ionlang/const/const_name.h>
+#include <ionlang/misc/profiler.h>
 #include <ionlang/syntax/parser.h>
 
 namespace ionlang {
@@ -104,10 +105,13 @@ namespace ionlang {
 
     Parser::Parser(
         TokenStream stream,
-        ionshared::Ptr<ionshared::DiagnosticBuilder> diagnosticBuilder
+        ionshared::Ptr<ionshared::DiagnosticBuilder> diagnosticBuilder,
+        ionshared::Ptr<TypeContext> typeContext
     ) :
         tokenStream(std::move(stream)),
         diagnosticBuilder(std::move(diagnosticBuilder)),
+        typeContext(std::move(typeContext)),
+        pendingRefs(),
         sourceLocationMappingStartStack() {
         //
     }
@@ -119,20 +123,50 @@ namespace ionlang {
     AstPtrResult<> Parser::parseTopLevelFork(const ionshared::Ptr<Module> &parent) {
         this->beginSourceLocationMapping();
 
+        Attributes attributes = {};
+
+        // Attributes precede the construct they annotate (ex. '@keep fn ...').
+        if (this->is(TokenKind::SymbolAt)) {
+            AstResult<Attributes> attributesResult = this->parseAttributes(parent);
+
+            IONLANG_PARSER_ASSERT(util::hasValue(attributesResult))
+
+            attributes = util::getResultValue(attributesResult);
+        }
+
         switch (this->tokenStream.get().kind) {
             case TokenKind::KeywordFunction: {
-                return util::getResultValue(this->parseFunction(parent));
+                ionshared::Ptr<Function> function = util::getResultValue(this->parseFunction(parent));
+
+                function->setAttributes(function, std::move(attributes));
+
+                return function;
             }
 
             case TokenKind::KeywordGlobal: {
-                return util::getResultValue(this->parseGlobal(parent));
+                ionshared::Ptr<Global> global = util::getResultValue(this->parseGlobal(parent));
+
+                global->setAttributes(global, std::move(attributes));
+
+                return global;
             }
 
             case TokenKind::KeywordExtern: {
-                return util::getResultValue(this->parseExtern(parent));
+                ionshared::Ptr<Extern> externConstruct = util::getResultValue(this->parseExtern(parent));
+
+                externConstruct->setAttributes(externConstruct, std::move(attributes));
+
+                return externConstruct;
             }
 
             case TokenKind::KeywordStruct: {
+                if (!attributes.empty()) {
+                    this->diagnosticBuilder
+                        ->bootstrap(diagnostic::syntaxAttributesIgnored)
+                        ->setLocation(this->makeSourceLocation())
+                        ->finish();
+                }
+
                 return util::getResultValue(this->parseStruct(parent));
             }
 
@@ -200,7 +234,7 @@ namespace ionlang {
         IONLANG_PARSER_ASSERT(structNameResult.has_value())
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolBraceL))
 
-        Fields fields = ionshared::util::makePtrSymbolTable<Type>();
+        Fields fields = util::makePtrFlatSymbolTable<Type>();
 
         while (!this->is(TokenKind::SymbolBraceR)) {
             AstPtrResult<Type> fieldTypeResult = this->parseType();
@@ -255,6 +289,8 @@ namespace ionlang {
     }
 
     AstPtrResult<Module> Parser::parseModule() {
+        ProfileScope profileScope = ProfileScope("Parser::parseModule");
+
         // TODO: This should be present anywhere IONLANG_PARSER_ASSERT is used, because it invokes the finalizer.
         this->beginSourceLocationMapping();
 
@@ -265,10 +301,15 @@ namespace ionlang {
         IONLANG_PARSER_ASSERT(id.has_value())
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolBraceL))
 
-        Scope globalScope =
-            std::make_shared<ionshared::SymbolTable<ionshared::Ptr<Construct>>>();
+        ionshared::Ptr<Module> module = std::make_shared<Module>(
+            *id,
+            std::make_shared<Context>(),
+            util::makePtrFlatSymbolTable<Construct>(),
+            this->typeContext
+        );
 
-        ionshared::Ptr<Module> module = std::make_shared<Module>(*id, std::make_shared<Context>(globalScope));
+        // References created before this module belong to no module.
+        this->pendingRefs.clear();
 
         while (!this->is(TokenKind::SymbolBraceR)) {
             AstPtrResult<> topLevelConstructResult = this->parseTopLevelFork(module);
@@ -283,7 +324,7 @@ namespace ionlang {
                 }
 
                 // TODO: Ensure we're not re-defining something, issue a notice otherwise.
-                globalScope->set(*name, topLevelConstruct);
+                module->symbolTable->set(*name, topLevelConstruct);
             }
 
             // No more tokens to process.
@@ -296,6 +337,10 @@ namespace ionlang {
 
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolBraceR))
 
+        module->pendingRefs = std::move(this->pendingRefs);
+        this->pendingRefs.clear();
+        profileScope.addNodes(module->symbolTable->getSize());
+
         return module;
     }
 
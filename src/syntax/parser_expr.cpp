@@ -117,7 +117,7 @@ namespace ionlang {
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolParenthesesR))
 
         return std::make_shared<CallExpr>(
-            std::make_shared<Ref<>>(*calleeId, parent, RefKind::Function),
+            this->makeRef(*calleeId, parent, RefKind::Function),
             callArgs
         );
     }
@@ -6,8 +6,8 @@ namespace ionlang {
     AstPtrResult<Args> Parser::parseArgs() {
         this->beginSourceLocationMapping();
 
-        ionshared::Ptr<ionshared::SymbolTable<Arg>> args =
-            std::make_shared<ionshared::SymbolTable<Arg>>();
+        ionshared::Ptr<FlatSymbolTable<Arg>> args =
+            std::make_shared<FlatSymbolTable<Arg>>();
 
         bool isVariable = false;
 
@@ -9,7 +9,7 @@ namespace ionlang {
         AstPtrResult<Statement> statement;
 
         // TODO: Symbol table is not being used. Variable decls should be registered?
-        ionshared::PtrSymbolTable<VariableDeclStatement> symbolTable = parent->symbolTable;
+        PtrFlatSymbolTable<VariableDeclStatement> symbolTable = parent->symbolTable;
 
         TokenKind currentTokenKind = this->tokenStream.get().kind;
 
@@ -142,7 +142,7 @@ namespace ionlang {
         return std::make_shared<AssignmentStatement>(AssignmentStatementOpts{
             parent,
 
-            std::make_shared<Ref<VariableDeclStatement>>(
+            this->makeRef<VariableDeclStatement>(
                 *id,
                 parent,
                 RefKind::Variable
@@ -97,13 +97,13 @@ namespace ionlang {
          */
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::TypeVoid))
 
-        return std::make_shared<VoidType>();
+        return this->typeContext->getVoidType();
     }
 
     AstPtrResult<BooleanType> Parser::parseBooleanType(const ionshared::Ptr<TypeQualifiers> &qualifiers) {
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::TypeBool))
 
-        return std::make_shared<BooleanType>(qualifiers);
+        return this->typeContext->getBooleanType(qualifiers);
     }
 
     AstPtrResult<IntegerType> Parser::parseIntegerType(const ionshared::Ptr<TypeQualifiers> &qualifiers) {
@@ -127,7 +127,7 @@ namespace ionlang {
         // Skip over the type token.
         this->tokenStream.skip();
 
-        return std::make_shared<IntegerType>(
+        return this->typeContext->getIntegerType(
             *integerKind,
             false,
             qualifiers
@@ -120,7 +120,7 @@ namespace ionlang {
         }
 
         ionshared::Ptr<IntegerType> integerType =
-            std::make_shared<IntegerType>(*valueIntegerKind);
+            this->typeContext->getIntegerType(*valueIntegerKind);
 
         ionshared::Ptr<IntegerLiteral> integerLiteral =
             std::make_shared<IntegerLiteral>(integerType, value);
@@ -157,7 +157,7 @@ namespace ionlang {
         }
 
         ionshared::Ptr<BooleanLiteral> booleanLiteral =
-            std::make_shared<BooleanLiteral>(boolValue);
+            std::make_shared<BooleanLiteral>(boolValue, this->typeContext->getBooleanType());
 
         this->finishSourceLocationMapping(booleanLiteral);
 
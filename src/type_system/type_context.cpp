@@ -0,0 +1,128 @@
+#include <ionlang/type_system/type_context.h>
+
+namespace ionlang {
+    bool TypeContext::TypeKey::operator==(const TypeKey &other) const noexcept {
+        return this->kind == other.kind
+            && this->bitWidth == other.bitWidth
+            && this->isSigned == other.isSigned
+            && this->qualifierMask == other.qualifierMask;
+    }
+
+    size_t TypeContext::TypeKeyHash::operator()(const TypeKey &key) const noexcept {
+        return (static_cast<size_t>(key.kind) << 24)
+            ^ (static_cast<size_t>(key.bitWidth) << 9)
+            ^ (static_cast<size_t>(key.isSigned) << 8)
+            ^ key.qualifierMask;
+    }
+
+    uint8_t TypeContext::makeQualifierMask(const ionshared::Ptr<TypeQualifiers> &qualifiers) {
+        if (qualifiers == nullptr) {
+            return 0;
+        }
+
+        uint8_t mask = 0;
+
+        for (const TypeQualifier qualifier : {
+            TypeQualifier::Constant,
+            TypeQualifier::Mutable,
+            TypeQualifier::Reference,
+            TypeQualifier::Pointer
+        }) {
+            if (qualifiers->contains(qualifier)) {
+                mask |= 1 << static_cast<uint8_t>(qualifier);
+            }
+        }
+
+        return mask;
+    }
+
+    ionshared::Ptr<TypeQualifiers> TypeContext::copyQualifiers(const ionshared::Ptr<TypeQualifiers> &qualifiers) {
+        // The caller may still modify its own set later on.
+        return qualifiers != nullptr
+            ? std::make_shared<TypeQualifiers>(*qualifiers)
+            : std::make_shared<TypeQualifiers>();
+    }
+
+    ionshared::Ptr<TypeContext> TypeContext::getDefault() {
+        static ionshared::Ptr<TypeContext> defaultContext =
+            std::make_shared<TypeContext>();
+
+        return defaultContext;
+    }
+
+    TypeContext::TypeContext() :
+        types(),
+        mutex() {
+        //
+    }
+
+    ionshared::Ptr<IntegerType> TypeContext::getIntegerType(
+        IntegerKind integerKind,
+        bool isSigned,
+        const ionshared::Ptr<TypeQualifiers> &qualifiers
+    ) {
+        TypeKey key{
+            TypeKind::Integer,
+            static_cast<uint32_t>(integerKind),
+            isSigned,
+            TypeContext::makeQualifierMask(qualifiers)
+        };
+
+        return this->intern<IntegerType>(key, [&] {
+            return std::make_shared<IntegerType>(
+                integerKind,
+                isSigned,
+                TypeContext::copyQualifiers(qualifiers)
+            );
+        });
+    }
+
+    ionshared::Ptr<BooleanType> TypeContext::getBooleanType(const ionshared::Ptr<TypeQualifiers> &qualifiers) {
+        TypeKey key{
+            TypeKind::Boolean,
+            1,
+            false,
+            TypeContext::makeQualifierMask(qualifiers)
+        };
+
+        return this->intern<BooleanType>(key, [&] {
+            return std::make_shared<BooleanType>(TypeContext::copyQualifiers(qualifiers));
+        });
+    }
+
+    ionshared::Ptr<VoidType> TypeContext::getVoidType() {
+        TypeKey key{TypeKind::Void, 0, false, 0};
+
+        return this->intern<VoidType>(key, [] {
+            return std::make_shared<VoidType>();
+        });
+    }
+
+    ionshared::Ptr<Type> TypeContext::getQualifiedType(
+        const ionshared::Ptr<Type> &type,
+        const ionshared::Ptr<TypeQualifiers> &qualifiers
+    ) {
+        switch (type->typeKind) {
+            case TypeKind::Integer: {
+                IntegerType *integerType = type->rawCast<IntegerType>();
+
+                return this->getIntegerType(integerType->integerKind, integerType->isSigned, qualifiers);
+            }
+
+            case TypeKind::Boolean: {
+                return this->getBooleanType(qualifiers);
+            }
+
+            default: {
+                // TODO: Better error.
+                throw std::runtime_error("Only integer and boolean types may be qualified through a type context");
+            }
+        }
+    }
+
+    size_t TypeContext::getSize() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        return this->types.size();
+    }
+}
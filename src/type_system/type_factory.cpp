@@ -1,8 +1,9 @@
 #include <ionlang/type_system/type_factory.h>
+#include <ionlang/type_system/type_context.h>
 
 namespace ionlang::type_factory {
     ionshared::Ptr<IntegerType> typeInteger(IntegerKind integerKind, bool isSigned) {
-        return std::make_shared<IntegerType>(integerKind, isSigned);
+        return TypeContext::getDefault()->getIntegerType(integerKind, isSigned);
     }
 
     ionshared::Ptr<IntegerType> typeInteger8(bool isSigned) {
@@ -26,7 +27,7 @@ namespace ionlang::type_factory {
     }
 
     ionshared::Ptr<BooleanType> typeBoolean() {
-        return std::make_shared<BooleanType>();
+        return TypeContext::getDefault()->getBooleanType();
     }
 
     ionshared::Ptr<IntegerType> typeChar() {
@@ -39,6 +40,6 @@ namespace ionlang::type_factory {
     }
 
     ionshared::Ptr<VoidType> typeVoid() {
-        return std::make_shared<VoidType>();
+        return TypeContext::getDefault()->getVoidType();
     }
 }
@@ -0,0 +1,205 @@
+#include <ionlang/passes/semantic/algebraic_simplification_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+static ionshared::Ptr<BinaryOperation> makeOperation(
+    const ionshared::Ptr<IntegerType> &type,
+    Operator operation,
+    ionshared::Ptr<Construct> leftSide,
+    int64_t rightSide
+) {
+    return std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type,
+        operation,
+        std::move(leftSide),
+        std::make_shared<IntegerLiteral>(type, rightSide)
+    });
+}
+
+/**
+ * Whether the value is the given operation, with the given
+ * literal as its right side.
+ */
+static bool isOperation(const ionshared::Ptr<Construct> &value, Operator operation, int64_t rightSide) {
+    ionshared::Ptr<BinaryOperation> binaryOperation = value->dynamicCast<BinaryOperation>();
+
+    if (binaryOperation == nullptr || binaryOperation->getOperator() != operation) {
+        return false;
+    }
+
+    std::optional<Constant> constant = ConstantEvaluator::findConstant(binaryOperation->getRightSide()->get());
+
+    return constant.has_value() && std::get<IntegerConstant>(*constant).value == rightSide;
+}
+
+TEST(AlgebraicSimplificationPassTest, RemoveIdentities) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type,
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type, 1)
+    );
+
+    ionshared::Ptr<VariableRefExpr> fooRef = test::bootstrap::resolvedVariableRef(foo);
+
+    // (foo + 0) * 1.
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type,
+        test::constant::bar,
+        makeOperation(type, Operator::Multiplication, makeOperation(type, Operator::Addition, fooRef, 0), 1)
+    );
+
+    ionshared::Ptr<VariableRefExpr> negatedFooRef = test::bootstrap::resolvedVariableRef(foo);
+
+    ionshared::Ptr<VariableDeclStatement> foobar = statementBuilder->createVariableDecl(
+        type,
+        test::constant::foobar,
+
+        std::make_shared<UnaryOperation>(
+            type,
+            Operator::Subtraction,
+            std::make_shared<UnaryOperation>(type, Operator::Subtraction, negatedFooRef)
+        )
+    );
+
+    AlgebraicSimplificationPass pass = AlgebraicSimplificationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    EXPECT_EQ(bar->value, fooRef);
+    EXPECT_EQ(foobar->value, negatedFooRef);
+}
+
+TEST(AlgebraicSimplificationPassTest, ReduceStrengthRespectingSignedness) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<IntegerType> signedType = type_factory::typeInteger32();
+    ionshared::Ptr<IntegerType> unsignedType = type_factory::typeInteger32(false);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        unsignedType,
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(unsignedType, 1)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        signedType,
+        test::constant::bar,
+        std::make_shared<IntegerLiteral>(signedType, 1)
+    );
+
+    std::vector<ionshared::Ptr<VariableDeclStatement>> variableDecls = {
+        statementBuilder->createVariableDecl(
+            unsignedType,
+            test::constant::foobar,
+            makeOperation(unsignedType, Operator::Multiplication, test::bootstrap::resolvedVariableRef(foo), 8)
+        ),
+
+        statementBuilder->createVariableDecl(
+            unsignedType,
+            test::constant::foobar,
+            makeOperation(unsignedType, Operator::Division, test::bootstrap::resolvedVariableRef(foo), 8)
+        ),
+
+        statementBuilder->createVariableDecl(
+            unsignedType,
+            test::constant::foobar,
+            makeOperation(unsignedType, Operator::Modulo, test::bootstrap::resolvedVariableRef(foo), 8)
+        ),
+
+        statementBuilder->createVariableDecl(
+            signedType,
+            test::constant::foobar,
+            makeOperation(signedType, Operator::Multiplication, test::bootstrap::resolvedVariableRef(bar), 8)
+        ),
+
+        // Signed divisions would round differently once shifted.
+        statementBuilder->createVariableDecl(
+            signedType,
+            test::constant::foobar,
+            makeOperation(signedType, Operator::Division, test::bootstrap::resolvedVariableRef(bar), 8)
+        )
+    };
+
+    AlgebraicSimplificationPass pass = AlgebraicSimplificationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    EXPECT_TRUE(isOperation(variableDecls[0]->value, Operator::ShiftLeft, 3));
+    EXPECT_TRUE(isOperation(variableDecls[1]->value, Operator::ShiftRight, 3));
+    EXPECT_TRUE(isOperation(variableDecls[2]->value, Operator::BitwiseAnd, 7));
+    EXPECT_TRUE(isOperation(variableDecls[3]->value, Operator::ShiftLeft, 3));
+    EXPECT_TRUE(isOperation(variableDecls[4]->value, Operator::Division, 8));
+    EXPECT_EQ(pass.getReplacementCount(), 4);
+}
+
+TEST(AlgebraicSimplificationPassTest, ReassociateLiterals) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type,
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type, 1)
+    );
+
+    ionshared::Ptr<VariableRefExpr> fooRef = test::bootstrap::resolvedVariableRef(foo);
+
+    // 2 + (foo + 3).
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type,
+        test::constant::bar,
+
+        std::make_shared<BinaryOperation>(BinaryOperationOpts{
+            type,
+            Operator::Addition,
+            std::make_shared<IntegerLiteral>(type, 2),
+            makeOperation(type, Operator::Addition, fooRef, 3)
+        })
+    );
+
+    AlgebraicSimplificationPass(std::make_shared<ionshared::PassContext>()).visit(function);
+
+    ASSERT_TRUE(isOperation(bar->value, Operator::Addition, 5));
+    EXPECT_EQ(bar->value->staticCast<BinaryOperation>()->getLeftSide(), fooRef);
+}
+
+TEST(AlgebraicSimplificationPassTest, EvaluateShifts) {
+    ionshared::Ptr<IntegerType> signedType = type_factory::typeInteger8();
+    ionshared::Ptr<IntegerType> unsignedType = type_factory::typeInteger8(false);
+
+    EvaluationResult signedResult = ConstantEvaluator::evaluateBinary(
+        Operator::ShiftRight,
+        IntegerConstant{signedType, -8},
+        IntegerConstant{signedType, 1}
+    );
+
+    // 0xF8 shifted logically.
+    EvaluationResult unsignedResult = ConstantEvaluator::evaluateBinary(
+        Operator::ShiftRight,
+        IntegerConstant{unsignedType, 248},
+        IntegerConstant{unsignedType, 1}
+    );
+
+    ASSERT_TRUE(signedResult.value.has_value());
+    ASSERT_TRUE(unsignedResult.value.has_value());
+    EXPECT_EQ(std::get<IntegerConstant>(*signedResult.value).value, -4);
+    EXPECT_EQ(std::get<IntegerConstant>(*unsignedResult.value).value, 124);
+
+    EXPECT_EQ(
+        ConstantEvaluator::evaluateBinary(
+            Operator::ShiftLeft,
+            IntegerConstant{signedType, 1},
+            IntegerConstant{signedType, 8}
+        ).status,
+
+        EvaluationStatus::Unsupported
+    );
+}
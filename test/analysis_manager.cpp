@@ -0,0 +1,128 @@
+#include <ionlang/analysis/block_analysis.h>
+#include <ionlang/misc/statement_builder.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(AnalysisManagerTest, CacheUntilModified) {
+    AnalysisManager analysisManager = AnalysisManager();
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    StatementBuilder statementBuilder = StatementBuilder(function->body);
+
+    EXPECT_TRUE(analysisManager.get<TerminalsAnalysis>(function->body.get())->empty());
+    EXPECT_TRUE(analysisManager.get<TerminalsAnalysis>(function->body.get())->empty());
+    EXPECT_EQ(analysisManager.getMissCount(), 1);
+    EXPECT_EQ(analysisManager.getHitCount(), 1);
+
+    // Appending a statement invalidates the block's results.
+    ionshared::Ptr<ReturnStatement> returnStatement = statementBuilder.createReturn();
+
+    std::shared_ptr<const TerminalsAnalysis::Result> terminals =
+        analysisManager.get<TerminalsAnalysis>(function->body.get());
+
+    ASSERT_EQ(terminals->size(), 1);
+    EXPECT_EQ(terminals->front(), returnStatement.get());
+    EXPECT_EQ(analysisManager.getMissCount(), 2);
+}
+
+TEST(AnalysisManagerTest, InvalidateOnRelocation) {
+    AnalysisManager analysisManager = AnalysisManager();
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<Block> detachedBlock = std::make_shared<Block>(nullptr);
+    ionshared::Ptr<Block> nestedBlock = std::make_shared<Block>(nullptr);
+
+    auto blockWrapper = std::make_shared<BlockWrapperStatement>(BlockWrapperStatementOpts{
+        detachedBlock,
+        nestedBlock
+    });
+
+    nestedBlock->parent = blockWrapper;
+    detachedBlock->appendStatement(blockWrapper);
+
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(nestedBlock.get()), nullptr);
+
+    // Moving the wrapper into the function changes the nested block's ancestors.
+    detachedBlock->relocateStatements(function->body);
+
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(nestedBlock.get()), function.get());
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(nestedBlock.get()), function.get());
+    EXPECT_EQ(analysisManager.getMissCount(), 2);
+    EXPECT_EQ(analysisManager.getHitCount(), 1);
+}
+
+TEST(AnalysisManagerTest, InvalidatePerTree) {
+    AnalysisManager analysisManager = AnalysisManager();
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> otherFunction = test::bootstrap::emptyFunction();
+
+    ionshared::Ptr<BinaryOperation> sum = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type_factory::typeInteger32(),
+        Operator::Addition,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1),
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 2)
+    });
+
+    function->body->createBuilder()->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+
+        std::make_shared<BinaryOperation>(BinaryOperationOpts{
+            type_factory::typeInteger32(),
+            Operator::Multiplication,
+            sum,
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 3)
+        })
+    );
+
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(function->body.get()), function.get());
+
+    // Modifying another tree leaves the result valid.
+    otherFunction->body->createBuilder()->createReturn();
+
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(function->body.get()), function.get());
+    EXPECT_EQ(analysisManager.getHitCount(), 1);
+
+    // Nested expressions reach the module through their parents.
+    ASSERT_TRUE(sum->replaceChild(
+        sum->getLeftSide().get(),
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 4)
+    ));
+
+    EXPECT_EQ(sum->findTreeRoot(), module.get());
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(function->body.get()), function.get());
+    EXPECT_EQ(analysisManager.getMissCount(), 2);
+}
+
+TEST(AnalysisManagerTest, DoNotOwnResults) {
+    AnalysisManager analysisManager = AnalysisManager();
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    std::weak_ptr<Block> body = function->body;
+
+    EXPECT_EQ(*analysisManager.get<ParentFunctionAnalysis>(function->body.get()), function.get());
+    EXPECT_TRUE(analysisManager.get<TerminalsAnalysis>(function->body.get())->empty());
+
+    // Cached results do not keep the tree alive.
+    function = nullptr;
+
+    EXPECT_TRUE(body.expired());
+
+    analysisManager.prune();
+
+    EXPECT_EQ(analysisManager.getSize(), 0);
+}
+
+TEST(AnalysisManagerTest, PruneStaleResults) {
+    AnalysisManager analysisManager = AnalysisManager();
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<Function> otherFunction = test::bootstrap::emptyFunction();
+
+    EXPECT_TRUE(analysisManager.get<TerminalsAnalysis>(function->body.get())->empty());
+    EXPECT_TRUE(analysisManager.get<TerminalsAnalysis>(otherFunction->body.get())->empty());
+
+    function->body->createBuilder()->createReturn();
+    analysisManager.prune();
+
+    EXPECT_EQ(analysisManager.getSize(), 1);
+}
@@ -0,0 +1,53 @@
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(BlockTest, SliceMovesStatementsAndSymbols) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<Block> body = function->body;
+    StatementBuilder statementBuilder = StatementBuilder(body);
+
+    statementBuilder.createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> variableDecl = statementBuilder.createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::bar,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 2)
+    );
+
+    ionshared::Ptr<ReturnStatement> returnStatement = statementBuilder.createReturn();
+    ionshared::Ptr<Block> slicedBlock = body->slice(1);
+
+    EXPECT_EQ(body->statements.size(), 1);
+    EXPECT_EQ(slicedBlock->statements.size(), 2);
+    EXPECT_EQ(slicedBlock->statements[0], variableDecl);
+    EXPECT_EQ(slicedBlock->statements[1], returnStatement);
+    EXPECT_EQ(slicedBlock->getUnboxedParent(), function);
+    EXPECT_EQ(variableDecl->getUnboxedParent(), slicedBlock);
+    EXPECT_TRUE(body->symbolTable->contains(test::constant::foo));
+    EXPECT_FALSE(body->symbolTable->contains(test::constant::bar));
+    EXPECT_TRUE(slicedBlock->symbolTable->contains(test::constant::bar));
+}
+
+TEST(BlockTest, RelocateStatementsRejectsInvalidRange) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<Block> body = function->body;
+    ionshared::Ptr<Block> target = std::make_shared<Block>(function);
+    StatementBuilder statementBuilder = StatementBuilder(body);
+
+    statementBuilder.createReturn();
+    statementBuilder.createReturn();
+
+    EXPECT_THROW(body->relocateStatements(target, 2, 1), std::out_of_range);
+    EXPECT_THROW(body->relocateStatements(target, 0, 3), std::out_of_range);
+    EXPECT_THROW(body->relocateStatements(body, 0), std::invalid_argument);
+    EXPECT_EQ(body->relocateStatements(target, 1, 1), 0);
+    EXPECT_EQ(body->relocateStatements(target, 0), 2);
+    EXPECT_TRUE(body->statements.empty());
+}
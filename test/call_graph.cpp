@@ -0,0 +1,55 @@
+#include <ionlang/analysis/call_graph.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(CallGraphTest, CallersAndCallees) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+
+    // Repeated call sites yield a single edge.
+    test::bootstrap::appendCall(foo, bar, test::constant::bar);
+    test::bootstrap::appendCall(foo, bar, test::constant::bar);
+
+    CallGraph callGraph = CallGraph::build(module.get());
+
+    EXPECT_EQ(callGraph.getNodes().size(), 2);
+    EXPECT_EQ(callGraph.getCallees(foo.get()), std::vector<Construct *>{bar.get()});
+    EXPECT_EQ(callGraph.getCallers(bar.get()), std::vector<Construct *>{foo.get()});
+    EXPECT_TRUE(callGraph.getCallers(foo.get()).empty());
+    EXPECT_FALSE(callGraph.isRecursive(foo.get()));
+}
+
+TEST(CallGraphTest, StronglyConnectedComponents) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> main = test::bootstrap::moduleFunction(module, "main");
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<Function> foobar = test::bootstrap::moduleFunction(module, test::constant::foobar);
+
+    // Main calls the mutually recursive foo and bar, which call foobar.
+    test::bootstrap::appendCall(main, foo, test::constant::foo);
+    test::bootstrap::appendCall(foo, bar, test::constant::bar);
+    test::bootstrap::appendCall(bar, foo, test::constant::foo);
+    test::bootstrap::appendCall(bar, foobar, test::constant::foobar);
+    test::bootstrap::appendCall(foobar, foobar, test::constant::foobar);
+
+    CallGraph callGraph = CallGraph::build(module.get());
+
+    ASSERT_EQ(callGraph.getComponents().size(), 3);
+    EXPECT_EQ(callGraph.findComponentIndex(foo.get()), callGraph.findComponentIndex(bar.get()));
+    EXPECT_TRUE(callGraph.isRecursive(foo.get()));
+    EXPECT_TRUE(callGraph.isRecursive(foobar.get()));
+    EXPECT_FALSE(callGraph.isRecursive(main.get()));
+
+    // Callees precede their callers.
+    std::vector<Construct *> bottomUpOrder = callGraph.getBottomUpOrder();
+
+    ASSERT_EQ(bottomUpOrder.size(), 4);
+    EXPECT_EQ(bottomUpOrder.front(), foobar.get());
+    EXPECT_EQ(bottomUpOrder.back(), main.get());
+    EXPECT_EQ(callGraph.getTopDownOrder().front(), main.get());
+
+    module->teardown();
+}
@@ -16,7 +16,7 @@ TEST(CodeGenTest, VisitExtern) {
     // TODO: No parent module.
     ionshared::Ptr<Extern> externConstruct = std::make_shared<Extern>(nullptr, prototype);
 
-    ionIrCodegenPass->visitExtern(externConstruct);
+    ionIrCodegenPass->visitExtern(externConstruct.get());
 
     ionshared::OptPtr<ionir::Module> ionIrModuleBuffer = ionIrCodegenPass->getModuleBuffer();
 
@@ -58,7 +58,7 @@ TEST(CodeGenTest, VisitIfStatement) {
     ifStatement->parent = function->body;
 
     // Visit the function.
-    ionIrLoweringPass->visitFunction(function);
+    ionIrLoweringPass->visitFunction(function.get());
 
     ionshared::OptPtr<ionir::Module> ionIrModuleBuffer = ionIrLoweringPass->getModuleBuffer();
 
@@ -100,7 +100,7 @@ TEST(CodeGenTest, VisitVariableDecl) {
     variableDecl->parent = function->body;
 
     // Visit the function.
-    ionIrLoweringPass->visitFunction(function);
+    ionIrLoweringPass->visitFunction(function.get());
 
     ionshared::OptPtr<ionir::Module> ionIrModuleBuffer = ionIrLoweringPass->getModuleBuffer();
 
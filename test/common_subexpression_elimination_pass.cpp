@@ -0,0 +1,141 @@
+#include <ionlang/passes/semantic/common_subexpression_elimination_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Create the addition of both variables, referring to them
+ * with resolved references.
+ */
+static ionshared::Ptr<BinaryOperation> makeSum(
+    const ionshared::Ptr<VariableDeclStatement> &leftSide,
+    const ionshared::Ptr<VariableDeclStatement> &rightSide
+) {
+    return std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type_factory::typeInteger32(),
+        Operator::Addition,
+        test::bootstrap::resolvedVariableRef(leftSide),
+        test::bootstrap::resolvedVariableRef(rightSide)
+    });
+}
+
+TEST(CommonSubexpressionEliminationPassTest, ReuseRepeatedOperation) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::bar,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 2)
+    );
+
+    ionshared::Ptr<BinaryOperation> sum = makeSum(foo, bar);
+
+    statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::foobar, sum);
+    statementBuilder->createAssignment(foo, makeSum(foo, bar));
+
+    CommonSubexpressionEliminationPass pass =
+        CommonSubexpressionEliminationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    std::vector<ionshared::Ptr<Statement>> &statements = function->body->statements;
+
+    ASSERT_EQ(statements.size(), 5);
+    ASSERT_EQ(statements[2]->statementKind, StatementKind::VariableDeclaration);
+
+    auto temporary = statements[2]->staticCast<VariableDeclStatement>();
+
+    EXPECT_EQ(temporary->value, sum);
+    EXPECT_NE(function->body->symbolTable->find(temporary->name), nullptr);
+
+    // Both occurrences now refer to the temporary.
+    for (size_t i = 3; i < statements.size(); i++) {
+        ionshared::Ptr<Construct> value = statements[i]->statementKind == StatementKind::Assignment
+            ? statements[i]->staticCast<AssignmentStatement>()->value
+            : statements[i]->staticCast<VariableDeclStatement>()->value;
+
+        ionshared::Ptr<VariableRefExpr> variableRefExpr = value->dynamicCast<VariableRefExpr>();
+
+        ASSERT_NE(variableRefExpr, nullptr);
+        EXPECT_EQ(variableRefExpr->getVariableDecl()->value, temporary);
+    }
+
+    EXPECT_EQ(pass.getEliminatedExpressionCount(), 1);
+}
+
+TEST(CommonSubexpressionEliminationPassTest, RespectInterveningAssignments) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<Block> consequentBlock = std::make_shared<Block>(nullptr);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::bar,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 2)
+    );
+
+    // The sum read on either side of an assignment to one of its operands differs.
+    statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::foobar, makeSum(foo, bar));
+    statementBuilder->createAssignment(foo, std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 3));
+    statementBuilder->createReturn(makeSum(foo, bar));
+
+    // Assignments within nested blocks are accounted for as well.
+    consequentBlock->createBuilder()->createAssignment(bar, std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 3));
+    statementBuilder->createIf(std::make_shared<BooleanLiteral>(true), consequentBlock, std::nullopt);
+    statementBuilder->createReturn(makeSum(foo, bar));
+
+    CommonSubexpressionEliminationPass pass =
+        CommonSubexpressionEliminationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    EXPECT_EQ(function->body->statements.size(), 7);
+    EXPECT_EQ(pass.getEliminatedExpressionCount(), 0);
+}
+
+TEST(CommonSubexpressionEliminationPassTest, ReusePureCalls) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<Extern> foobar = test::bootstrap::moduleExtern(module, test::constant::foobar);
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(foo->body);
+
+    bar->prototype->returnType = type_factory::typeInteger32();
+    foobar->prototype->returnType = type_factory::typeInteger32();
+
+    auto makeCall = [&foo](const ionshared::Ptr<Construct> &callee, const std::string &name) {
+        return std::make_shared<CallExpr>(
+            std::make_shared<Ref<>>(name, foo->body, RefKind::Function, callee),
+            CallArgs{}
+        );
+    };
+
+    // Bar is pure, as it calls nothing, while the extern is not annotated.
+    statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::foo, makeCall(bar, test::constant::bar));
+    statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::bar, makeCall(bar, test::constant::bar));
+    statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::foo, makeCall(foobar, test::constant::foobar));
+    statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::bar, makeCall(foobar, test::constant::foobar));
+
+    CommonSubexpressionEliminationPass pass =
+        CommonSubexpressionEliminationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(module);
+
+    EXPECT_EQ(foo->body->statements.size(), 5);
+    EXPECT_EQ(pass.getEliminatedExpressionCount(), 1);
+}
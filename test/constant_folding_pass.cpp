@@ -0,0 +1,148 @@
+#include <ionlang/passes/semantic/constant_folding_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+static ionshared::Ptr<BinaryOperation> makeBinaryOperation(
+    Operator operation,
+    ionshared::Ptr<Construct> leftSide,
+    ionshared::Ptr<Construct> rightSide
+) {
+    return std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type_factory::typeInteger32(),
+        operation,
+        std::move(leftSide),
+        std::move(rightSide)
+    });
+}
+
+static ionshared::Ptr<IntegerLiteral> makeInteger(ionshared::Ptr<IntegerType> type, int64_t value) {
+    return std::make_shared<IntegerLiteral>(std::move(type), value);
+}
+
+/**
+ * Declare a variable holding the given value within a new function, fold
+ * the function, then retrieve the variable's value. Diagnostics are
+ * reported to the given context.
+ */
+static ionshared::Ptr<Construct> foldVariableValue(
+    ionshared::Ptr<Construct> value,
+    ionshared::Ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>()
+) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    ionshared::Ptr<VariableDeclStatement> variableDecl = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::move(value)
+    );
+
+    ConstantFoldingPass(std::move(context)).visit(function);
+
+    return variableDecl->value;
+}
+
+TEST(ConstantFoldingPassTest, FoldNestedOperations) {
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    // 2 + (3 * 4).
+    ionshared::Ptr<Construct> value = foldVariableValue(makeBinaryOperation(
+        Operator::Addition,
+        makeInteger(type, 2),
+        makeBinaryOperation(Operator::Multiplication, makeInteger(type, 3), makeInteger(type, 4))
+    ));
+
+    ionshared::OptPtr<IntegerLiteral> literal = value->dynamicCast<IntegerLiteral>();
+
+    ASSERT_TRUE(ionshared::util::hasValue(literal));
+    EXPECT_EQ(literal->get()->value, 14);
+    EXPECT_EQ(literal->get()->type, type);
+}
+
+TEST(ConstantFoldingPassTest, FoldComparisonAndNegation) {
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    // -5 < 1.
+    ionshared::Ptr<Construct> value = foldVariableValue(makeBinaryOperation(
+        Operator::LessThan,
+        std::make_shared<UnaryOperation>(type, Operator::Subtraction, makeInteger(type, 5)),
+        makeInteger(type, 1)
+    ));
+
+    ionshared::OptPtr<BooleanLiteral> literal = value->dynamicCast<BooleanLiteral>();
+
+    ASSERT_TRUE(ionshared::util::hasValue(literal));
+    EXPECT_TRUE(literal->get()->value);
+}
+
+TEST(ConstantFoldingPassTest, WrapAroundOnOverflow) {
+    ionshared::Ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>();
+    ionshared::Ptr<IntegerType> signedType = type_factory::typeInteger8();
+    ionshared::Ptr<IntegerType> unsignedType = type_factory::typeInteger8(false);
+
+    ionshared::Ptr<Construct> signedValue = foldVariableValue(makeBinaryOperation(
+        Operator::Addition,
+        makeInteger(signedType, 100),
+        makeInteger(signedType, 28)
+    ), context);
+
+    ionshared::Ptr<Construct> unsignedValue = foldVariableValue(makeBinaryOperation(
+        Operator::Subtraction,
+        makeInteger(unsignedType, 1),
+        makeInteger(unsignedType, 2)
+    ), context);
+
+    EXPECT_EQ(signedValue->staticCast<IntegerLiteral>()->value, -128);
+    EXPECT_EQ(unsignedValue->staticCast<IntegerLiteral>()->value, 255);
+    EXPECT_EQ(test::bootstrap::countDiagnostics(context, diagnostic::semanticConstantOverflow), 2);
+}
+
+TEST(ConstantFoldingPassTest, KeepDivisionByZero) {
+    ionshared::Ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>();
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    ionshared::Ptr<BinaryOperation> division = makeBinaryOperation(
+        Operator::Division,
+        makeInteger(type, 1),
+        makeInteger(type, 0)
+    );
+
+    EXPECT_EQ(foldVariableValue(division, context), division);
+    EXPECT_EQ(test::bootstrap::countDiagnostics(context, diagnostic::semanticDivisionByZero), 1);
+}
+
+TEST(ConstantFoldingPassTest, UseModuleTypeContext) {
+    ionshared::Ptr<TypeContext> typeContext = std::make_shared<TypeContext>();
+
+    ionshared::Ptr<Module> module = std::make_shared<Module>(
+        test::constant::foo,
+        std::make_shared<Context>(),
+        util::makePtrFlatSymbolTable<Construct>(),
+        typeContext
+    );
+
+    ionshared::Ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<IntegerType> type = typeContext->getIntegerType(IntegerKind::Int32);
+
+    // 1 < 2.
+    ionshared::Ptr<VariableDeclStatement> variableDecl = StatementBuilder(function->body).createVariableDecl(
+        typeContext->getBooleanType(),
+        test::constant::foo,
+        std::make_shared<BinaryOperation>(BinaryOperationOpts{
+            type,
+            Operator::LessThan,
+            makeInteger(type, 1),
+            makeInteger(type, 2)
+        })
+    );
+
+    ConstantFoldingPass(std::make_shared<ionshared::PassContext>()).visit(function);
+
+    ionshared::OptPtr<BooleanLiteral> literal = variableDecl->value->dynamicCast<BooleanLiteral>();
+
+    ASSERT_TRUE(ionshared::util::hasValue(literal));
+    EXPECT_EQ(literal->get()->type, typeContext->getBooleanType());
+}
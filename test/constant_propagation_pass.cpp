@@ -0,0 +1,88 @@
+#include <ionlang/passes/semantic/constant_propagation_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ConstantPropagationPassTest, PruneConstantBranches) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<Block> consequentBlock = std::make_shared<Block>(nullptr);
+    ionshared::Ptr<Block> alternativeBlock = std::make_shared<Block>(nullptr);
+
+    ionshared::Ptr<VariableDeclStatement> flag = statementBuilder->createVariableDecl(
+        type_factory::typeBoolean(),
+        test::constant::foo,
+        std::make_shared<BooleanLiteral>(false)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> unsetFlag = statementBuilder->createVariableDecl(
+        type_factory::typeBoolean(),
+        test::constant::bar,
+        std::make_shared<BooleanLiteral>(false)
+    );
+
+    // Taken, as the flag is reassigned beforehand.
+    statementBuilder->createAssignment(flag, std::make_shared<BooleanLiteral>(true));
+    statementBuilder->createIf(test::bootstrap::resolvedVariableRef(flag), consequentBlock, alternativeBlock);
+
+    // Never taken, and thus removed.
+    statementBuilder->createIf(test::bootstrap::resolvedVariableRef(unsetFlag), std::make_shared<Block>(nullptr), std::nullopt);
+
+    ConstantPropagationPass pass = ConstantPropagationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    std::vector<ionshared::Ptr<Statement>> &statements = function->body->statements;
+
+    ASSERT_EQ(statements.size(), 4);
+    ASSERT_EQ(statements[3]->statementKind, StatementKind::BlockWrapper);
+    EXPECT_EQ(statements[3]->staticCast<BlockWrapperStatement>()->block, consequentBlock);
+    EXPECT_EQ(pass.getPrunedBranchCount(), 2);
+}
+
+TEST(ConstantPropagationPassTest, MergeBranchValues) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<Block> consequentBlock = std::make_shared<Block>(nullptr);
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    ionshared::Ptr<VariableDeclStatement> same = statementBuilder->createVariableDecl(
+        type,
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type, 1)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> changed = statementBuilder->createVariableDecl(
+        type,
+        test::constant::bar,
+        std::make_shared<IntegerLiteral>(type, 2)
+    );
+
+    // The condition is unknown (its reference is unresolved), thus both paths are possible.
+    auto unknownCondition = std::make_shared<VariableRefExpr>(std::make_shared<Ref<VariableDeclStatement>>(
+        same->name,
+        same->getUnboxedParent(),
+        RefKind::Variable
+    ));
+
+    statementBuilder->createIf(unknownCondition, consequentBlock, std::nullopt);
+    consequentBlock->createBuilder()->createAssignment(changed, std::make_shared<IntegerLiteral>(type, 3));
+
+    ionshared::Ptr<VariableDeclStatement> sameCopy =
+        statementBuilder->createVariableDecl(type, test::constant::foobar, test::bootstrap::resolvedVariableRef(same));
+
+    ionshared::Ptr<VariableRefExpr> changedRef = test::bootstrap::resolvedVariableRef(changed);
+    ionshared::Ptr<VariableDeclStatement> changedCopy =
+        statementBuilder->createVariableDecl(type, test::constant::foobar, changedRef);
+
+    ConstantPropagationPass pass = ConstantPropagationPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    ASSERT_EQ(sameCopy->value->constructKind, ConstructKind::Value);
+    EXPECT_EQ(sameCopy->value->staticCast<IntegerLiteral>()->value, 1);
+    EXPECT_EQ(changedCopy->value, changedRef);
+    EXPECT_EQ(pass.getSubstitutionCount(), 1);
+}
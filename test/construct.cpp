@@ -0,0 +1,53 @@
+#include <ionlang/passes/pass.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/lexical/lexer.h>
+#include <ionlang/misc/util.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * A module holding a single function which calls itself. Once names
+ * are resolved, every back link of the tree is exercised: parents of
+ * the function, its prototype, body and statements, and a resolved
+ * reference pointing back to the enclosing function.
+ */
+static const std::string recursiveModuleSource =
+    "module foo { fn foobar() -> void { foobar(); } }";
+
+TEST(ConstructTest, ParentLinksDoNotOwn) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    std::weak_ptr<Block> body = function->body;
+
+    EXPECT_EQ(function->body->getUnboxedParent(), function);
+
+    function = nullptr;
+
+    EXPECT_TRUE(body.expired());
+}
+
+TEST(ConstructTest, TeardownReleasesModules) {
+    const uint32_t count = 10000;
+    std::vector<std::weak_ptr<Construct>> functions = {};
+
+    functions.reserve(count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        Parser parser = test::bootstrap::parser(Lexer(recursiveModuleSource).scan());
+        AstPtrResult<Module> moduleResult = parser.parseModule();
+
+        ASSERT_TRUE(util::hasValue(moduleResult));
+
+        ionshared::Ptr<Module> module = util::getResultValue(moduleResult);
+
+        NameResolutionPass(std::make_shared<ionshared::PassContext>()).visit(module);
+        test::bootstrap::ionIrLoweringPass()->visit(module);
+
+        functions.push_back(*module->symbolTable->lookup(test::constant::foobar));
+        module->teardown();
+    }
+
+    for (const auto &function : functions) {
+        EXPECT_TRUE(function.expired());
+    }
+}
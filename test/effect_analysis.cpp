@@ -0,0 +1,70 @@
+#include <ionlang/analysis/effect_analysis.h>
+#include <ionlang/passes/pass.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+static void annotate(const ionshared::Ptr<Extern> &externConstruct, std::string_view attributeName) {
+    externConstruct->setAttributes(externConstruct, Attributes{
+        std::make_shared<Attribute>(externConstruct, std::string(attributeName))
+    });
+}
+
+TEST(EffectAnalysisTest, InheritEffectsFromCallees) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Extern> pureExtern = test::bootstrap::moduleExtern(module, "pureExtern");
+    ionshared::Ptr<Extern> readOnlyExtern = test::bootstrap::moduleExtern(module, "readOnlyExtern");
+    ionshared::Ptr<Extern> effectfulExtern = test::bootstrap::moduleExtern(module, "effectfulExtern");
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<Function> foobar = test::bootstrap::moduleFunction(module, test::constant::foobar);
+    ionshared::Ptr<Function> main = test::bootstrap::moduleFunction(module, "main");
+
+    annotate(pureExtern, EffectSummary::pureAttributeName);
+    annotate(readOnlyExtern, EffectSummary::readOnlyAttributeName);
+
+    test::bootstrap::appendCall(foo, pureExtern, "pureExtern");
+    test::bootstrap::appendCall(bar, foo, test::constant::foo);
+    test::bootstrap::appendCall(bar, readOnlyExtern, "readOnlyExtern");
+    test::bootstrap::appendCall(foobar, bar, test::constant::bar);
+    test::bootstrap::appendCall(main, foobar, test::constant::foobar);
+    test::bootstrap::appendCall(main, effectfulExtern, "effectfulExtern");
+
+    EffectSummary effectSummary = EffectSummary::build(CallGraph::build(module.get()));
+
+    EXPECT_EQ(effectSummary.getEffect(pureExtern.get()), Effect::Pure);
+    EXPECT_EQ(effectSummary.getEffect(effectfulExtern.get()), Effect::SideEffecting);
+    EXPECT_TRUE(effectSummary.isPure(foo.get()));
+    EXPECT_EQ(effectSummary.getEffect(bar.get()), Effect::ReadOnly);
+    EXPECT_EQ(effectSummary.getEffect(foobar.get()), Effect::ReadOnly);
+    EXPECT_EQ(effectSummary.getEffect(main.get()), Effect::SideEffecting);
+}
+
+TEST(EffectAnalysisTest, RecursionAndUnresolvedCalls) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<Function> foobar = test::bootstrap::moduleFunction(module, test::constant::foobar);
+
+    // Mutually recursive functions without any other calls remain pure.
+    test::bootstrap::appendCall(foo, bar, test::constant::bar);
+    test::bootstrap::appendCall(bar, foo, test::constant::foo);
+
+    foobar->body->appendStatement(std::make_shared<ExprWrapperStatement>(ExprWrapperStatementOpts{
+        foobar->body,
+
+        std::make_shared<CallExpr>(
+            std::make_shared<Ref<>>("unknown", foobar->body, RefKind::Function),
+            CallArgs{}
+        )
+    }));
+
+    AnalysisManager analysisManager = AnalysisManager();
+    std::shared_ptr<const EffectSummary> effectSummary = analysisManager.get<EffectAnalysis>(module.get());
+
+    EXPECT_TRUE(effectSummary->isPure(foo.get()));
+    EXPECT_TRUE(effectSummary->isPure(bar.get()));
+    EXPECT_EQ(effectSummary->getEffect(foobar.get()), Effect::SideEffecting);
+
+    module->teardown();
+}
@@ -0,0 +1,61 @@
+#include <ionlang/tracking/flat_symbol_table.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(FlatSymbolTableTest, SetAndLookup) {
+    FlatSymbolTable<int> symbolTable = FlatSymbolTable<int>();
+
+    EXPECT_TRUE(symbolTable.set(test::constant::foo, 1));
+    EXPECT_FALSE(symbolTable.set(test::constant::foo, 2));
+    EXPECT_TRUE(symbolTable.contains(test::constant::foo));
+    EXPECT_FALSE(symbolTable.contains(test::constant::bar));
+    EXPECT_EQ(symbolTable.lookup(test::constant::foo), 2);
+    EXPECT_EQ(symbolTable.find(test::constant::bar), nullptr);
+    EXPECT_EQ(symbolTable.getSize(), 1);
+}
+
+TEST(FlatSymbolTableTest, IterateInInsertionOrder) {
+    FlatSymbolTable<int> symbolTable = FlatSymbolTable<int>();
+    const int count = 10000;
+
+    for (int i = 0; i < count; i++) {
+        symbolTable.set(std::to_string(count - i), i);
+    }
+
+    // Removing and re-setting moves a key to the end.
+    EXPECT_TRUE(symbolTable.remove(std::to_string(count)));
+    EXPECT_FALSE(symbolTable.remove(std::to_string(count)));
+    symbolTable.set(std::to_string(count), count);
+
+    int expected = 1;
+
+    symbolTable.forEach([&](const std::string &key, int value) {
+        EXPECT_EQ(value, expected);
+        EXPECT_EQ(symbolTable.lookup(key), value);
+        expected++;
+    });
+
+    EXPECT_EQ(expected, count + 1);
+    EXPECT_EQ(symbolTable.getSize(), count);
+}
+
+TEST(FlatSymbolTableTest, RemoveMostEntries) {
+    FlatSymbolTable<int> symbolTable = FlatSymbolTable<int>();
+
+    for (int i = 0; i < 1000; i++) {
+        symbolTable.set(std::to_string(i), i);
+    }
+
+    for (int i = 0; i < 1000; i++) {
+        if (i % 10 != 0) {
+            EXPECT_TRUE(symbolTable.remove(std::to_string(i)));
+        }
+    }
+
+    EXPECT_EQ(symbolTable.getSize(), 100);
+
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(symbolTable.contains(std::to_string(i)), i % 10 == 0);
+    }
+}
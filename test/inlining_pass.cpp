@@ -0,0 +1,231 @@
+#include <ionlang/passes/semantic/inlining_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include <ionlang/misc/util.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Create a module holding a function named foo which returns the
+ * value of its own local, and a function named bar which calls it.
+ */
+ionshared::Ptr<Module> makeInliningModule() {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(foo->body);
+
+    ionshared::Ptr<VariableDeclStatement> local = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foobar,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    statementBuilder->createReturn(std::make_shared<VariableRefExpr>(std::make_shared<Ref<VariableDeclStatement>>(
+        local->name,
+        foo->body,
+        RefKind::Variable,
+        local
+    )));
+
+    test::bootstrap::moduleFunction(module, test::constant::bar);
+
+    return module;
+}
+
+TEST(InliningPassTest, InlineCallIntoDeclaration) {
+    ionshared::Ptr<Module> module = makeInliningModule();
+    auto foo = (*module->symbolTable->lookup(test::constant::foo))->staticCast<Function>();
+    auto bar = (*module->symbolTable->lookup(test::constant::bar))->staticCast<Function>();
+    ionshared::Ptr<CallExpr> callExpr = test::bootstrap::appendCall(bar, foo, test::constant::foo);
+
+    // Move the call into a declaration of the caller.
+    bar->body->removeStatements(0);
+
+    ionshared::Ptr<VariableDeclStatement> result = StatementBuilder(bar->body).createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::bar,
+        callExpr
+    );
+
+    InliningPass inliningPass = InliningPass(std::make_shared<ionshared::PassContext>());
+
+    inliningPass.visit(module);
+
+    EXPECT_EQ(inliningPass.getInlinedCallCount(), 1);
+    ASSERT_EQ(bar->body->statements.size(), 2);
+
+    // The callee's local was copied and renamed.
+    auto localCopy = bar->body->statements.front()->staticCast<VariableDeclStatement>();
+
+    EXPECT_NE(localCopy->name, test::constant::foobar);
+    EXPECT_EQ(localCopy->getUnboxedParent(), bar->body);
+    EXPECT_TRUE(ionshared::util::hasValue(bar->body->symbolTable->lookup(localCopy->name)));
+
+    // The call was replaced by the returned value, referring to the copy.
+    ASSERT_EQ(bar->body->statements.back(), result);
+
+    auto resultValue = result->value->staticCast<VariableRefExpr>();
+
+    EXPECT_EQ(resultValue->expressionKind, ExpressionKind::VariableRef);
+    EXPECT_EQ(*resultValue->getVariableDecl()->value, localCopy);
+
+    // The callee is left intact.
+    EXPECT_EQ(foo->body->statements.size(), 2);
+
+    module->teardown();
+}
+
+TEST(InliningPassTest, DropDiscardedValue) {
+    ionshared::Ptr<Module> module = makeInliningModule();
+    auto foo = (*module->symbolTable->lookup(test::constant::foo))->staticCast<Function>();
+    auto bar = (*module->symbolTable->lookup(test::constant::bar))->staticCast<Function>();
+
+    test::bootstrap::appendCall(bar, foo, test::constant::foo);
+    InliningPass(std::make_shared<ionshared::PassContext>()).visit(module);
+
+    // Only the copied local remains, as the returned value is unused.
+    ASSERT_EQ(bar->body->statements.size(), 1);
+    EXPECT_EQ(bar->body->statements.front()->statementKind, StatementKind::VariableDeclaration);
+
+    module->teardown();
+}
+
+TEST(InliningPassTest, RespectAttributesAndCostModel) {
+    ionshared::Ptr<Module> module = makeInliningModule();
+    auto foo = (*module->symbolTable->lookup(test::constant::foo))->staticCast<Function>();
+    auto bar = (*module->symbolTable->lookup(test::constant::bar))->staticCast<Function>();
+
+    test::bootstrap::appendCall(bar, foo, test::constant::foo);
+
+    // The callee exceeds the threshold.
+    InliningPass restrictedPass = InliningPass(std::make_shared<ionshared::PassContext>(), 1);
+
+    restrictedPass.visit(module);
+    EXPECT_EQ(restrictedPass.getInlinedCallCount(), 0);
+
+    foo->setAttributes(foo, Attributes{
+        std::make_shared<Attribute>(foo, std::string(InliningPass::noInlineAttributeName))
+    });
+
+    InliningPass inliningPass = InliningPass(std::make_shared<ionshared::PassContext>());
+
+    inliningPass.visit(module);
+    EXPECT_EQ(inliningPass.getInlinedCallCount(), 0);
+
+    // Forcing inlining overrides the threshold.
+    foo->setAttributes(foo, Attributes{
+        std::make_shared<Attribute>(foo, std::string(InliningPass::inlineAttributeName))
+    });
+
+    restrictedPass.visit(module);
+    EXPECT_EQ(restrictedPass.getInlinedCallCount(), 1);
+
+    module->teardown();
+}
+
+TEST(InliningPassTest, SkipRecursiveFunctions) {
+    ionshared::Ptr<Module> module = makeInliningModule();
+    auto bar = (*module->symbolTable->lookup(test::constant::bar))->staticCast<Function>();
+
+    test::bootstrap::appendCall(bar, bar, test::constant::bar);
+
+    InliningPass inliningPass = InliningPass(std::make_shared<ionshared::PassContext>());
+
+    inliningPass.visit(module);
+    EXPECT_EQ(inliningPass.getInlinedCallCount(), 0);
+    EXPECT_EQ(bar->body->statements.size(), 1);
+
+    module->teardown();
+}
+
+TEST(InliningPassTest, BindArgumentToParameter) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    foo->prototype->args->items->set(test::constant::foobar, Arg{type, test::constant::foobar});
+
+    // Parameters are referenced by name, as they have no declaration.
+    StatementBuilder(foo->body).createReturn(std::make_shared<VariableRefExpr>(
+        std::make_shared<Ref<VariableDeclStatement>>(test::constant::foobar, foo->body, RefKind::Variable)
+    ));
+
+    ionshared::Ptr<IntegerLiteral> argument = std::make_shared<IntegerLiteral>(type, 5);
+    ionshared::Ptr<CallExpr> callExpr = test::bootstrap::appendCall(bar, foo, test::constant::foo);
+
+    callExpr->args.push_back(util::tryCastValue(argument));
+    bar->body->removeStatements(0);
+    StatementBuilder(bar->body).createReturn(callExpr);
+
+    InliningPass(std::make_shared<ionshared::PassContext>()).visit(module);
+
+    ASSERT_EQ(bar->body->statements.size(), 2);
+
+    auto parameterDecl = bar->body->statements.front()->staticCast<VariableDeclStatement>();
+    auto returnStatement = bar->body->statements.back()->staticCast<ReturnStatement>();
+
+    EXPECT_EQ(parameterDecl->value.get(), argument.get());
+    ASSERT_TRUE(returnStatement->hasValue());
+
+    auto returnValue = returnStatement->value->get()->staticCast<VariableRefExpr>();
+
+    EXPECT_EQ(*returnValue->getVariableDecl()->value, parameterDecl);
+
+    module->teardown();
+}
+
+TEST(InliningPassTest, BindArgumentsByPosition) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    // Declared in the opposite order of their names.
+    foo->prototype->args->items->set(test::constant::foobar, Arg{type, test::constant::foobar});
+    foo->prototype->args->items->set(test::constant::bar, Arg{type, test::constant::bar});
+
+    auto makeParameterRef = [&foo](const std::string &name) {
+        return std::make_shared<VariableRefExpr>(
+            std::make_shared<Ref<VariableDeclStatement>>(name, foo->body, RefKind::Variable)
+        );
+    };
+
+    StatementBuilder(foo->body).createReturn(std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type,
+        Operator::Subtraction,
+        makeParameterRef(test::constant::foobar),
+        makeParameterRef(test::constant::bar)
+    }));
+
+    ionshared::Ptr<IntegerLiteral> firstArgument = std::make_shared<IntegerLiteral>(type, 5);
+    ionshared::Ptr<IntegerLiteral> secondArgument = std::make_shared<IntegerLiteral>(type, 2);
+    ionshared::Ptr<CallExpr> callExpr = test::bootstrap::appendCall(bar, foo, test::constant::foo);
+
+    callExpr->args.push_back(util::tryCastValue(firstArgument));
+    callExpr->args.push_back(util::tryCastValue(secondArgument));
+    bar->body->removeStatements(0);
+    StatementBuilder(bar->body).createReturn(callExpr);
+
+    InliningPass inliningPass = InliningPass(std::make_shared<ionshared::PassContext>());
+
+    inliningPass.visit(module);
+
+    ASSERT_EQ(inliningPass.getInlinedCallCount(), 1);
+    ASSERT_EQ(bar->body->statements.size(), 3);
+
+    auto firstDecl = bar->body->statements[0]->staticCast<VariableDeclStatement>();
+    auto secondDecl = bar->body->statements[1]->staticCast<VariableDeclStatement>();
+
+    EXPECT_EQ(firstDecl->value.get(), firstArgument.get());
+    EXPECT_EQ(secondDecl->value.get(), secondArgument.get());
+
+    auto returnStatement = bar->body->statements[2]->staticCast<ReturnStatement>();
+    auto difference = returnStatement->value->get()->staticCast<BinaryOperation>();
+
+    EXPECT_EQ(*difference->getLeftSide()->staticCast<VariableRefExpr>()->getVariableDecl()->value, firstDecl);
+    EXPECT_EQ(*difference->getRightSide()->get()->staticCast<VariableRefExpr>()->getVariableDecl()->value, secondDecl);
+
+    module->teardown();
+}
@@ -0,0 +1,150 @@
+#include <ionlang/passes/semantic/integer_narrowing_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(IntegerNarrowingPassTest, NarrowSmallLocals) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type_factory::typeInteger64(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger64(), 3)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type_factory::typeInteger64(),
+        test::constant::bar,
+
+        std::make_shared<BinaryOperation>(BinaryOperationOpts{
+            type_factory::typeInteger64(),
+            Operator::Multiplication,
+            test::bootstrap::resolvedVariableRef(foo),
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger64(), 1000)
+        })
+    );
+
+    IntegerNarrowingPass pass = IntegerNarrowingPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    EXPECT_EQ(foo->type, type_factory::typeInteger16());
+    EXPECT_EQ(bar->type, type_factory::typeInteger16());
+
+    ionshared::Ptr<BinaryOperation> product = bar->value->dynamicCast<BinaryOperation>();
+
+    ASSERT_NE(product, nullptr);
+    EXPECT_EQ(product->type, type_factory::typeInteger16());
+    EXPECT_EQ(product->getRightSide()->get()->staticCast<IntegerLiteral>()->type, type_factory::typeInteger16());
+    EXPECT_EQ(foo->value->staticCast<IntegerLiteral>()->type, type_factory::typeInteger16());
+    EXPECT_EQ(pass.getNarrowedVariableCount(), 2);
+}
+
+TEST(IntegerNarrowingPassTest, KeepEscapingLocals) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type_factory::typeInteger64(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger64(), 3)
+    );
+
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type_factory::typeInteger64(),
+        test::constant::bar,
+
+        std::make_shared<BinaryOperation>(BinaryOperationOpts{
+            type_factory::typeInteger64(),
+            Operator::Addition,
+            test::bootstrap::resolvedVariableRef(foo),
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger64(), 1)
+        })
+    );
+
+    // The returned value keeps its type, and thus so do the locals it is computed from.
+    statementBuilder->createReturn(test::bootstrap::resolvedVariableRef(bar));
+
+    IntegerNarrowingPass pass = IntegerNarrowingPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    EXPECT_EQ(foo->type, type_factory::typeInteger64());
+    EXPECT_EQ(bar->type, type_factory::typeInteger64());
+    EXPECT_EQ(pass.getNarrowedVariableCount(), 0);
+}
+
+TEST(IntegerNarrowingPassTest, FoldDecidedComparisons) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 3)
+    );
+
+    auto makeComparison = [&foo](Operator operation, int64_t value) {
+        return std::make_shared<BinaryOperation>(BinaryOperationOpts{
+            type_factory::typeBoolean(),
+            operation,
+            test::bootstrap::resolvedVariableRef(foo),
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), value)
+        });
+    };
+
+    // The local holds either value wherever it is read.
+    statementBuilder->createAssignment(foo, std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 5));
+
+    ionshared::Ptr<IfStatement> decidedIf = statementBuilder->createIf(
+        makeComparison(Operator::LessThan, 10),
+        std::make_shared<Block>(nullptr),
+        std::nullopt
+    );
+
+    ionshared::Ptr<IfStatement> undecidedIf = statementBuilder->createIf(
+        makeComparison(Operator::GreaterThan, 4),
+        std::make_shared<Block>(nullptr),
+        std::nullopt
+    );
+
+    IntegerNarrowingPass pass = IntegerNarrowingPass(std::make_shared<ionshared::PassContext>());
+
+    pass.visit(function);
+
+    ionshared::Ptr<BooleanLiteral> booleanLiteral = decidedIf->condition->dynamicCast<BooleanLiteral>();
+
+    ASSERT_NE(booleanLiteral, nullptr);
+    EXPECT_TRUE(booleanLiteral->value);
+    EXPECT_EQ(undecidedIf->condition->dynamicCast<BooleanLiteral>(), nullptr);
+    EXPECT_EQ(pass.getFoldedComparisonCount(), 1);
+}
+
+TEST(IntegerNarrowingPassTest, NarrowWithinModuleTypeContext) {
+    ionshared::Ptr<TypeContext> typeContext = std::make_shared<TypeContext>();
+
+    ionshared::Ptr<Module> module = std::make_shared<Module>(
+        test::constant::foo,
+        std::make_shared<Context>(),
+        util::makePtrFlatSymbolTable<Construct>(),
+        typeContext
+    );
+
+    ionshared::Ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<IntegerType> int64 = typeContext->getIntegerType(IntegerKind::Int64);
+
+    ionshared::Ptr<VariableDeclStatement> foo = StatementBuilder(function->body).createVariableDecl(
+        int64,
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(int64, 3)
+    );
+
+    IntegerNarrowingPass(std::make_shared<ionshared::PassContext>()).visit(function);
+
+    // Narrowed types remain comparable by identity with the module's own.
+    EXPECT_EQ(foo->type, typeContext->getIntegerType(IntegerKind::Int8));
+    EXPECT_NE(foo->type, type_factory::typeInteger8());
+}
@@ -0,0 +1,51 @@
+#include <ionlang/misc/memory_report.h>
+#include <ionlang/misc/statement_builder.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(MemoryReportTest, CountNodesByKind) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    StatementBuilder statementBuilder = StatementBuilder(function->body);
+
+    module->symbolTable->set(test::constant::foobar, function);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        statementBuilder.createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo + std::to_string(i),
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), i)
+        );
+    }
+
+    statementBuilder.createReturn();
+
+    MemoryReport report = MemoryReport::collect(module);
+
+    EXPECT_EQ(report.byConstructKind.at(ConstructKind::Module).nodeCount, 1);
+    EXPECT_EQ(report.byConstructKind.at(ConstructKind::Function).nodeCount, 1);
+    EXPECT_EQ(report.byConstructKind.at(ConstructKind::Block).nodeCount, 1);
+    EXPECT_EQ(report.byStatementKind.at(StatementKind::VariableDeclaration).nodeCount, 3);
+    EXPECT_EQ(report.byStatementKind.at(StatementKind::Return).nodeCount, 1);
+    EXPECT_EQ(report.byValueKind.at(ValueKind::Integer).nodeCount, 3);
+
+    // The interned 32-bit integer type is counted once, but referenced six times.
+    EXPECT_EQ(report.byTypeKind.at(TypeKind::Integer).nodeCount, 1);
+    EXPECT_GE(report.sharedTypeCount, 1);
+    EXPECT_GE(report.typeReferenceCount, 6);
+
+    size_t constructBytes = 0;
+
+    for (const auto &[kind, usage] : report.byConstructKind) {
+        constructBytes += usage.bytes;
+    }
+
+    EXPECT_EQ(constructBytes, report.total.bytes);
+    EXPECT_EQ(
+        report.byConstructKind.at(ConstructKind::Statement).bytes,
+        report.byStatementKind.at(StatementKind::VariableDeclaration).bytes
+            + report.byStatementKind.at(StatementKind::Return).bytes
+    );
+}
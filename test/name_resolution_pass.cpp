@@ -1,4 +1,5 @@
 #include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/passes/pass_manager.h>
 #include <ionlang/type_system/type_factory.h>
 #include <ionlang/misc/statement_builder.h>
 #include "pch.h"
@@ -51,6 +52,216 @@ TEST(NameResolutionPassTest, Run) {
 //    EXPECT_EQ(assignmentStatement->getValue(), functionBody);
 }
 
+/**
+ * Wrap a new block within the given one, returning the new block.
+ */
+static ionshared::Ptr<Block> appendNestedBlock(const ionshared::Ptr<Block> &block) {
+    ionshared::Ptr<Block> nestedBlock = std::make_shared<Block>(nullptr);
+
+    auto blockWrapper = std::make_shared<BlockWrapperStatement>(BlockWrapperStatementOpts{
+        block,
+        nestedBlock
+    });
+
+    nestedBlock->parent = blockWrapper;
+    block->appendStatement(blockWrapper);
+
+    return nestedBlock;
+}
+
+static ionshared::Ptr<AssignmentStatement> appendAssignment(const ionshared::Ptr<Block> &block, const std::string &id) {
+    auto assignmentStatement = std::make_shared<AssignmentStatement>(AssignmentStatementOpts{
+        block,
+        std::make_shared<Ref<VariableDeclStatement>>(id, block, RefKind::Variable),
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 2)
+    });
+
+    block->appendStatement(assignmentStatement);
+
+    return assignmentStatement;
+}
+
+TEST(NameResolutionPassTest, ResolveThroughNestedBlocks) {
+    NameResolutionPass nameResolutionPass =
+        NameResolutionPass(std::make_shared<ionshared::PassContext>());
+
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<Block> block = function->body;
+
+    ionshared::Ptr<VariableDeclStatement> outerVariableDecl =
+        StatementBuilder(block).createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo,
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+        );
+
+    // Resolution cost must not depend on the nesting depth.
+    for (uint32_t i = 0; i < 1000; i++) {
+        block = appendNestedBlock(block);
+    }
+
+    ionshared::Ptr<AssignmentStatement> outerAssignment = appendAssignment(block, test::constant::foo);
+
+    // Shadow the outer declaration within a further nested block.
+    ionshared::Ptr<Block> innerBlock = appendNestedBlock(block);
+
+    ionshared::Ptr<VariableDeclStatement> innerVariableDecl =
+        StatementBuilder(innerBlock).createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo,
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 3)
+        );
+
+    ionshared::Ptr<AssignmentStatement> innerAssignment = appendAssignment(innerBlock, test::constant::foo);
+
+    // Once the inner block is left, the outer declaration is visible again.
+    ionshared::Ptr<AssignmentStatement> lastAssignment = appendAssignment(block, test::constant::foo);
+
+    nameResolutionPass.visit(function);
+
+    EXPECT_EQ(**outerAssignment->variableDeclStatementRef, outerVariableDecl);
+    EXPECT_EQ(**innerAssignment->variableDeclStatementRef, innerVariableDecl);
+    EXPECT_EQ(**lastAssignment->variableDeclStatementRef, outerVariableDecl);
+}
+
+TEST(NameResolutionPassTest, RejectOutOfScopeReference) {
+    NameResolutionPass nameResolutionPass =
+        NameResolutionPass(std::make_shared<ionshared::PassContext>());
+
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<Block> innerBlock = appendNestedBlock(function->body);
+
+    StatementBuilder(innerBlock).createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    // The declaration is not visible from the enclosing block.
+    appendAssignment(function->body, test::constant::foo);
+
+    nameResolutionPass.visit(function);
+
+    ASSERT_EQ(nameResolutionPass.getUndefinedRefs().size(), 1);
+    EXPECT_EQ(nameResolutionPass.getUndefinedRefs()[0].name, test::constant::foo);
+    EXPECT_EQ(nameResolutionPass.getUndefinedRefs()[0].refKind, RefKind::Variable);
+}
+
+TEST(NameResolutionPassTest, DiscardStateBetweenTraversals) {
+    NameResolutionPass nameResolutionPass =
+        NameResolutionPass(std::make_shared<ionshared::PassContext>());
+
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+
+    appendAssignment(function->body, test::constant::foo);
+    nameResolutionPass.visit(function);
+
+    ASSERT_EQ(nameResolutionPass.getUndefinedRefs().size(), 1);
+
+    /**
+     * The first function may be freed by now, along with its references
+     * and declarations, neither of which are still referred to.
+     */
+    function = nullptr;
+
+    ionshared::Ptr<Function> otherFunction = test::bootstrap::emptyFunction();
+
+    StatementBuilder(otherFunction->body).createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    ionshared::Ptr<AssignmentStatement> assignment = appendAssignment(otherFunction->body, test::constant::foo);
+
+    nameResolutionPass.visit(otherFunction);
+
+    EXPECT_TRUE(nameResolutionPass.getUndefinedRefs().empty());
+    EXPECT_TRUE(assignment->variableDeclStatementRef->isResolved());
+}
+
+TEST(NameResolutionPassTest, ResolvePendingRefs) {
+    NameResolutionPass nameResolutionPass =
+        NameResolutionPass(std::make_shared<ionshared::PassContext>());
+
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+
+    ionshared::Ptr<VariableDeclStatement> variableDecl =
+        StatementBuilder(function->body).createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo,
+            std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+        );
+
+    ionshared::Ptr<Block> innerBlock = appendNestedBlock(function->body);
+    ionshared::Ptr<AssignmentStatement> assignment = appendAssignment(innerBlock, test::constant::foo);
+    ionshared::Ptr<AssignmentStatement> undefinedAssignment = appendAssignment(innerBlock, test::constant::bar);
+
+    // Refers to the function before it is declared on the module.
+    auto functionRef = std::make_shared<Ref<>>(test::constant::foobar, innerBlock, RefKind::Function);
+
+    module->pendingRefs = Ast{
+        assignment->variableDeclStatementRef,
+        undefinedAssignment->variableDeclStatementRef,
+        functionRef
+    };
+
+    module->symbolTable->set(test::constant::foobar, function);
+    nameResolutionPass.visit(module);
+
+    EXPECT_EQ(**assignment->variableDeclStatementRef, variableDecl);
+    EXPECT_EQ(**functionRef, function);
+    EXPECT_FALSE(module->pendingRefs.has_value());
+
+    // Every undefined reference is reported, rather than only the first.
+    ASSERT_EQ(nameResolutionPass.getUndefinedRefs().size(), 1);
+    EXPECT_EQ(nameResolutionPass.getUndefinedRefs()[0].name, test::constant::bar);
+}
+
+TEST(NameResolutionPassTest, PendingRefsRespectDeclarationOrder) {
+    NameResolutionPass nameResolutionPass =
+        NameResolutionPass(std::make_shared<ionshared::PassContext>());
+
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::foobar);
+
+    // Neither a use before the declaration, nor the declaration's own value may see it.
+    ionshared::Ptr<AssignmentStatement> earlyAssignment = appendAssignment(function->body, test::constant::foo);
+
+    auto selfRef = std::make_shared<Ref<VariableDeclStatement>>(
+        test::constant::foo,
+        function->body,
+        RefKind::Variable
+    );
+
+    ionshared::Ptr<VariableDeclStatement> variableDecl =
+        StatementBuilder(function->body).createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo,
+            std::make_shared<VariableRefExpr>(selfRef)
+        );
+
+    module->pendingRefs = Ast{
+        earlyAssignment->variableDeclStatementRef,
+        selfRef
+    };
+
+    nameResolutionPass.visit(module);
+
+    EXPECT_FALSE(earlyAssignment->variableDeclStatementRef->isResolved());
+    EXPECT_FALSE(selfRef->isResolved());
+    EXPECT_EQ(nameResolutionPass.getUndefinedRefs().size(), 2);
+    EXPECT_FALSE(module->pendingRefs.has_value());
+
+    // References added later on are found by walking the module on the next run.
+    ionshared::Ptr<AssignmentStatement> lateAssignment = appendAssignment(function->body, test::constant::foo);
+
+    nameResolutionPass.visit(module);
+
+    EXPECT_EQ(**lateAssignment->variableDeclStatementRef, variableDecl);
+}
+
 // TODO: Implement.
 //TEST(NameresolutionPassTest, ResolveCallExprCallee) {
 //    ionshared::Ptr<PassManager> passManager = std::make_shared<PassManager>();
@@ -0,0 +1,117 @@
+#include <ionlang/passes/fused_pass.h>
+#include <ionlang/passes/pass.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+namespace {
+    class BlockCountingPass : public Pass {
+    public:
+        ionshared::OptPtr<Block> skippedBlock = std::nullopt;
+
+        uint32_t blocksVisited = 0;
+
+        uint32_t blocksLeft = 0;
+
+        uint32_t resetCount = 0;
+
+        BlockCountingPass() :
+            Pass(std::make_shared<ionshared::PassContext>()) {
+            //
+        }
+
+        bool isFusible() const override {
+            return true;
+        }
+
+        void resetTraversalState() override {
+            this->resetCount++;
+        }
+
+        void visitBlock(Block *node) override {
+            this->blocksVisited++;
+        }
+
+        bool shouldVisitChildren(Construct *node) override {
+            return !this->skippedBlock.has_value() || node != this->skippedBlock->get();
+        }
+
+        void afterVisitChildren(Construct *node) override {
+            if (node->constructKind == ConstructKind::Block) {
+                this->blocksLeft++;
+            }
+        }
+    };
+}
+
+/**
+ * Create a chain of blocks, each wrapped by a statement inside
+ * its predecessor. Returns the outermost block.
+ */
+static ionshared::Ptr<Block> makeNestedBlocks(uint32_t depth) {
+    ionshared::Ptr<Block> root = std::make_shared<Block>(nullptr);
+    ionshared::Ptr<Block> current = root;
+
+    for (uint32_t i = 1; i < depth; i++) {
+        ionshared::Ptr<Block> nested = std::make_shared<Block>(nullptr);
+
+        current->appendStatement(std::make_shared<BlockWrapperStatement>(BlockWrapperStatementOpts{
+            current,
+            nested
+        }));
+
+        nested->parent = current;
+        current = nested;
+    }
+
+    return root;
+}
+
+TEST(PassTest, TraverseDeepAst) {
+    const uint32_t depth = 10000;
+    BlockCountingPass pass = BlockCountingPass();
+
+    ionshared::Ptr<Block> root = makeNestedBlocks(depth);
+
+    pass.visit(root);
+
+    EXPECT_EQ(pass.blocksVisited, depth);
+    EXPECT_EQ(pass.blocksLeft, depth);
+
+    // Letting the destructors cascade would recurse once per level.
+    root->teardown();
+}
+
+TEST(PassTest, SkipSubtree) {
+    ionshared::Ptr<Block> root = makeNestedBlocks(10);
+    BlockCountingPass pass = BlockCountingPass();
+
+    pass.skippedBlock = root;
+    pass.visit(root);
+
+    EXPECT_EQ(pass.blocksVisited, 1);
+    EXPECT_EQ(pass.blocksLeft, 1);
+}
+
+TEST(PassTest, FuseTraversals) {
+    ionshared::Ptr<Block> root = makeNestedBlocks(10);
+    auto skippingPass = std::make_shared<BlockCountingPass>();
+    auto countingPass = std::make_shared<BlockCountingPass>();
+
+    // Skip the third block's children, for the first pass only.
+    skippingPass->skippedBlock =
+        root->statements.front()->staticCast<BlockWrapperStatement>()->block
+            ->statements.front()->staticCast<BlockWrapperStatement>()->block;
+
+    FusedPass fusedPass = FusedPass({skippingPass, countingPass});
+
+    fusedPass.visit(root);
+
+    // Fused passes are not visited themselves, yet their state is reset.
+    EXPECT_EQ(skippingPass->resetCount, 1);
+    EXPECT_EQ(countingPass->resetCount, 1);
+    EXPECT_EQ(skippingPass->blocksVisited, 3);
+    EXPECT_EQ(skippingPass->blocksLeft, 3);
+    EXPECT_EQ(countingPass->blocksVisited, 10);
+    EXPECT_EQ(countingPass->blocksLeft, 10);
+}
@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <ionlang/analysis/block_analysis.h>
+#include <ionlang/passes/semantic/algebraic_simplification_pass.h>
+#include <ionlang/passes/semantic/constant_folding_pass.h>
+#include <ionlang/passes/fused_pass.h>
+#include <ionlang/passes/pass_manager.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+struct VisitLog {
+    std::mutex mutex;
+
+    std::vector<std::pair<std::string, const Construct *>> entries;
+
+    void record(const std::string &passName, const Construct *node) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->entries.emplace_back(passName, node);
+    }
+};
+
+class RecordingPass : public Pass {
+private:
+    std::string name;
+
+    ionshared::Ptr<VisitLog> log;
+
+public:
+    RecordingPass(std::string name, ionshared::Ptr<VisitLog> log, PassScope passScope) :
+        Pass(std::make_shared<ionshared::PassContext>(), passScope),
+        name(std::move(name)),
+        log(std::move(log)) {
+        //
+    }
+
+    ionshared::Ptr<Pass> clone() const override {
+        return std::make_shared<RecordingPass>(this->name, this->log, this->passScope);
+    }
+
+    void visitFunction(Function *node) override {
+        this->log->record(this->name, node);
+    }
+
+    void visitModule(Module *node) override {
+        this->log->record(this->name, node);
+    }
+};
+
+TEST(PassManagerTest, RunFunctionScopedPassesInParallel) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::set<const Construct *> functions = {};
+
+    for (uint32_t i = 0; i < 64; i++) {
+        ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+
+        module->symbolTable->set(test::constant::foo + std::to_string(i), function);
+        functions.insert(function.get());
+    }
+
+    auto log = std::make_shared<VisitLog>();
+    PassManager passManager = PassManager(4);
+
+    passManager.registerPass(std::make_shared<RecordingPass>("first", log, PassScope::Function));
+    passManager.registerPass(std::make_shared<RecordingPass>("second", log, PassScope::Function));
+    passManager.registerPass(std::make_shared<RecordingPass>("barrier", log, PassScope::Module));
+    passManager.registerPass(std::make_shared<RecordingPass>("third", log, PassScope::Function));
+    passManager.run({module});
+
+    // The module-scoped pass runs once, after the first stage is done.
+    std::vector<std::string> passNames = {};
+
+    for (const auto &[passName, node] : log->entries) {
+        passNames.push_back(passName);
+    }
+
+    auto barrier = std::find(passNames.begin(), passNames.end(), "barrier");
+
+    ASSERT_NE(barrier, passNames.end());
+    EXPECT_EQ(std::count(passNames.begin(), barrier, "third"), 0);
+    EXPECT_EQ(std::count(barrier, passNames.end(), "first"), 0);
+    EXPECT_EQ(std::count(barrier, passNames.end(), "second"), 0);
+
+    // Each function-scoped pass visits every function exactly once.
+    for (const std::string passName : {"first", "second", "third"}) {
+        std::multiset<const Construct *> visited = {};
+
+        for (const auto &[entryPassName, node] : log->entries) {
+            if (entryPassName == passName) {
+                visited.insert(node);
+            }
+        }
+
+        EXPECT_EQ(visited, std::multiset<const Construct *>(functions.begin(), functions.end()));
+    }
+}
+
+TEST(PassManagerTest, ReportDiagnosticsFromParallelPasses) {
+    ionshared::Ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>();
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    for (uint32_t i = 0; i < 64; i++) {
+        ionshared::Ptr<Function> function =
+            test::bootstrap::moduleFunction(module, test::constant::foo + std::to_string(i));
+
+        StatementBuilder(function->body).createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo,
+
+            std::make_shared<BinaryOperation>(BinaryOperationOpts{
+                type_factory::typeInteger32(),
+                Operator::Division,
+                std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1),
+                std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 0)
+            })
+        );
+    }
+
+    PassManager passManager = PassManager(4);
+
+    // Every clone reports through the same diagnostic builder.
+    passManager.registerPass(std::make_shared<ConstantFoldingPass>(context));
+    passManager.run({module});
+
+    EXPECT_EQ(test::bootstrap::countDiagnostics(context, diagnostic::semanticDivisionByZero), 64);
+}
+
+TEST(PassManagerTest, MergeStatisticsFromClones) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    for (uint32_t i = 0; i < 64; i++) {
+        ionshared::Ptr<Function> function =
+            test::bootstrap::moduleFunction(module, test::constant::foo + std::to_string(i));
+
+        StatementBuilder(function->body).createVariableDecl(
+            type_factory::typeInteger32(),
+            test::constant::foo,
+
+            std::make_shared<BinaryOperation>(BinaryOperationOpts{
+                type_factory::typeInteger32(),
+                Operator::Addition,
+                std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1),
+                std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 2)
+            })
+        );
+    }
+
+    auto constantFoldingPass = std::make_shared<ConstantFoldingPass>(std::make_shared<ionshared::PassContext>());
+    PassManager passManager = PassManager(4);
+
+    passManager.registerPass(constantFoldingPass);
+    passManager.run({module});
+
+    // Functions folded by the workers' clones are counted as well.
+    EXPECT_EQ(constantFoldingPass->getReplacementCount(), 64);
+
+    module->teardown();
+}
+
+TEST(PassManagerTest, ReleaseAnalysesAfterRun) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> moduleFunction = test::bootstrap::moduleFunction(module, test::constant::foo);
+    std::weak_ptr<Function> function = moduleFunction;
+    PassManager passManager = PassManager(1);
+
+    ASSERT_EQ(
+        *passManager.getAnalysisManager()->get<ParentFunctionAnalysis>(moduleFunction->body.get()),
+        moduleFunction.get()
+    );
+
+    moduleFunction = nullptr;
+
+    passManager.run({module});
+    module->teardown();
+    module = nullptr;
+
+    EXPECT_TRUE(function.expired());
+    EXPECT_EQ(passManager.getAnalysisManager()->getSize(), 0);
+}
+
+TEST(PassManagerTest, FuseSingleRewritePassPerGroup) {
+    auto constantFoldingPass = std::make_shared<ConstantFoldingPass>(std::make_shared<ionshared::PassContext>());
+
+    auto algebraicSimplificationPass =
+        std::make_shared<AlgebraicSimplificationPass>(std::make_shared<ionshared::PassContext>());
+
+    EXPECT_THROW(FusedPass({constantFoldingPass, algebraicSimplificationPass}), std::invalid_argument);
+
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<IntegerType> type = type_factory::typeInteger32();
+
+    // -(-3), which both passes rewrite.
+    ionshared::Ptr<VariableDeclStatement> variableDecl = StatementBuilder(function->body).createVariableDecl(
+        type,
+        test::constant::bar,
+
+        std::make_shared<UnaryOperation>(
+            type,
+            Operator::Subtraction,
+            std::make_shared<UnaryOperation>(type, Operator::Subtraction, std::make_shared<IntegerLiteral>(type, 3))
+        )
+    );
+
+    PassManager passManager = PassManager(1);
+
+    passManager.setFusionEnabled(true);
+    passManager.registerPass(constantFoldingPass);
+    passManager.registerPass(algebraicSimplificationPass);
+    passManager.run({module});
+
+    ionshared::OptPtr<IntegerLiteral> literal = variableDecl->value->dynamicCast<IntegerLiteral>();
+
+    ASSERT_TRUE(ionshared::util::hasValue(literal));
+    EXPECT_EQ(literal->get()->value, 3);
+
+    module->teardown();
+}
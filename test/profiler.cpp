@@ -0,0 +1,71 @@
+#include <ionlang/passes/pass_manager.h>
+#include <ionlang/misc/profiler.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+class NamedPass : public Pass {
+public:
+    NamedPass() :
+        Pass(std::make_shared<ionshared::PassContext>()) {
+        //
+    }
+
+    std::string_view getPassName() const override {
+        return "NamedPass";
+    }
+};
+
+TEST(ProfilerTest, RecordNothingWhenDisabled) {
+    Profiler profiler = Profiler();
+
+    {
+        ProfileScope profileScope = ProfileScope(test::constant::foo, "phase", profiler);
+
+        EXPECT_FALSE(profileScope.getIsActive());
+    }
+
+    EXPECT_TRUE(profiler.getEvents().empty());
+}
+
+TEST(ProfilerTest, RecordPasses) {
+    Profiler &profiler = Profiler::getDefault();
+    PassManager passManager = PassManager(1);
+
+    passManager.registerPass(std::make_shared<NamedPass>());
+    profiler.clear();
+    profiler.setIsEnabled(true);
+    passManager.run({test::bootstrap::emptyFunction()});
+    profiler.setIsEnabled(false);
+
+    std::vector<ProfileEvent> events = profiler.getEvents();
+
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].name, "NamedPass");
+    EXPECT_EQ(events[0].category, "pass");
+
+    // The function, its prototype, arguments, return type and body.
+    EXPECT_GT(events[0].nodeCount, 1);
+
+    EXPECT_NE(profiler.formatTable().find("NamedPass"), std::string::npos);
+    EXPECT_EQ(profiler.formatChromeTrace().rfind("{\"traceEvents\":[{\"name\":\"NamedPass\"", 0), 0);
+
+    profiler.clear();
+}
+
+TEST(ProfilerTest, MeasurePeakMemoryPerScope) {
+    Profiler profiler = Profiler(true);
+
+    {
+        ProfileScope profileScope = ProfileScope(test::constant::foo, "phase", profiler);
+    }
+
+    std::vector<ProfileEvent> events = profiler.getEvents();
+
+    ASSERT_EQ(events.size(), 1);
+
+    // Nothing was allocated, thus the process' own high-water mark is not reported.
+    if (Profiler::readPeakMemoryBytes() != 0) {
+        EXPECT_LT(events[0].peakMemoryGrowthBytes, Profiler::readPeakMemoryBytes());
+    }
+}
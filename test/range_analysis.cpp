@@ -0,0 +1,78 @@
+#include <ionlang/passes/pass.h>
+#include <ionlang/analysis/range_analysis.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(RangeAnalysisTest, MergeAssignedValues) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<Block> consequentBlock = std::make_shared<Block>(nullptr);
+
+    ionshared::Ptr<VariableDeclStatement> foo = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 3)
+    );
+
+    ionshared::Ptr<BinaryOperation> product = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type_factory::typeInteger32(),
+        Operator::Multiplication,
+        test::bootstrap::resolvedVariableRef(foo),
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 4)
+    });
+
+    ionshared::Ptr<VariableDeclStatement> bar =
+        statementBuilder->createVariableDecl(type_factory::typeInteger32(), test::constant::bar, product);
+
+    // The assignment is accounted for even though it appears after the product.
+    consequentBlock->createBuilder()->createAssignment(foo, std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 10));
+    statementBuilder->createIf(std::make_shared<BooleanLiteral>(true), consequentBlock, std::nullopt);
+
+    AnalysisManager analysisManager = AnalysisManager();
+    std::shared_ptr<const IntegerRanges> integerRanges = analysisManager.get<RangeAnalysis>(function.get());
+
+    EXPECT_EQ(integerRanges->findRange(foo.get()), (IntegerRange{3, 10}));
+    EXPECT_EQ(integerRanges->findRange(bar.get()), (IntegerRange{12, 40}));
+    EXPECT_EQ(integerRanges->findRange(product.get()), (IntegerRange{12, 40}));
+    EXPECT_FALSE(integerRanges->mayOverflow(product.get()));
+}
+
+TEST(RangeAnalysisTest, DetectOverflows) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    ionshared::Ptr<BinaryOperation> sum = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type_factory::typeInteger8(),
+        Operator::Addition,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger8(), 100),
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger8(), 100)
+    });
+
+    statementBuilder->createVariableDecl(type_factory::typeInteger8(), test::constant::foo, sum);
+
+    ionshared::Ptr<VariableDeclStatement> bar = statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::bar,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 0)
+    );
+
+    // Locals growing on every round eventually cover their whole type.
+    ionshared::Ptr<BinaryOperation> increment = std::make_shared<BinaryOperation>(BinaryOperationOpts{
+        type_factory::typeInteger32(),
+        Operator::Addition,
+        test::bootstrap::resolvedVariableRef(bar),
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    });
+
+    statementBuilder->createAssignment(bar, increment);
+
+    IntegerRanges integerRanges = IntegerRanges::build(function.get());
+
+    EXPECT_TRUE(integerRanges.mayOverflow(sum.get()));
+    EXPECT_EQ(integerRanges.findRange(sum.get()), IntegerRange::findTypeRange(*type_factory::typeInteger8()));
+    EXPECT_EQ(integerRanges.findRange(bar.get()), IntegerRange::findTypeRange(*type_factory::typeInteger32()));
+    EXPECT_TRUE(integerRanges.mayOverflow(increment.get()));
+}
@@ -0,0 +1,65 @@
+#include <ionlang/analysis/reachability_analysis.h>
+#include <ionlang/passes/pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ReachabilityAnalysisTest, FollowsCallsFromEntryPoint) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> main = test::bootstrap::moduleFunction(module, "main");
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+
+    test::bootstrap::appendCall(main, foo, test::constant::foo);
+
+    // Recursion must not revisit the function.
+    test::bootstrap::appendCall(foo, foo, test::constant::foo);
+
+    ReachabilityAnalysis::Result reachable = ReachabilityAnalysis::collect(module.get());
+
+    EXPECT_EQ(reachable.size(), 2);
+    EXPECT_EQ(reachable.count(main.get()), 1);
+    EXPECT_EQ(reachable.count(foo.get()), 1);
+    EXPECT_EQ(reachable.count(bar.get()), 0);
+
+    module->teardown();
+}
+
+TEST(ReachabilityAnalysisTest, KeepAttributeAndNamedRoots) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> foo = test::bootstrap::moduleFunction(module, test::constant::foo);
+    ionshared::Ptr<Function> bar = test::bootstrap::moduleFunction(module, test::constant::bar);
+    ionshared::Ptr<Global> global = std::make_shared<Global>(
+        module,
+        type_factory::typeInteger32(),
+        test::constant::foobar
+    );
+
+    module->symbolTable->set(test::constant::foobar, global);
+
+    global->setAttributes(global, Attributes{
+        std::make_shared<Attribute>(global, std::string(ReachabilityAnalysis::keepAttributeName))
+    });
+
+    EXPECT_TRUE(ReachabilityAnalysis::isRoot(global.get()));
+    EXPECT_FALSE(ReachabilityAnalysis::isRoot(foo.get()));
+
+    ReachabilityAnalysis::Result reachable =
+        ReachabilityAnalysis::collect(module.get(), {test::constant::bar});
+
+    EXPECT_EQ(reachable.size(), 2);
+    EXPECT_EQ(reachable.count(global.get()), 1);
+    EXPECT_EQ(reachable.count(bar.get()), 1);
+    EXPECT_EQ(reachable.count(foo.get()), 0);
+}
+
+TEST(ReachabilityAnalysisTest, CachedByAnalysisManager) {
+    ionshared::Ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    ionshared::Ptr<Function> main = test::bootstrap::moduleFunction(module, "main");
+    AnalysisManager analysisManager = AnalysisManager();
+
+    EXPECT_EQ(analysisManager.get<ReachabilityAnalysis>(module.get())->count(main.get()), 1);
+    EXPECT_EQ(analysisManager.get<ReachabilityAnalysis>(module.get())->size(), 1);
+    EXPECT_EQ(analysisManager.getHitCount(), 1);
+}
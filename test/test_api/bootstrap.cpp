@@ -85,4 +85,74 @@ namespace ionlang::test::bootstrap {
 
         return function;
     }
+
+    ionshared::Ptr<Function> moduleFunction(const ionshared::Ptr<Module> &module, const std::string &name) {
+        ionshared::Ptr<Function> function = emptyFunction();
+
+        function->prototype->name = name;
+        function->parent = module;
+        module->symbolTable->set(name, function);
+
+        return function;
+    }
+
+    ionshared::Ptr<Extern> moduleExtern(const ionshared::Ptr<Module> &module, const std::string &name) {
+        ionshared::Ptr<Prototype> prototype = std::make_shared<Prototype>(
+            name,
+            std::make_shared<Args>(),
+            type_factory::typeVoid(),
+            nullptr
+        );
+
+        ionshared::Ptr<Extern> externConstruct = std::make_shared<Extern>(module, prototype);
+
+        prototype->parent = externConstruct;
+        module->symbolTable->set(name, externConstruct);
+
+        return externConstruct;
+    }
+
+    ionshared::Ptr<CallExpr> appendCall(
+        const ionshared::Ptr<Function> &caller,
+        const ionshared::Ptr<Construct> &callee,
+        const std::string &name
+    ) {
+        ionshared::Ptr<Block> body = caller->body;
+
+        ionshared::Ptr<CallExpr> callExpr = std::make_shared<CallExpr>(
+            std::make_shared<Ref<>>(name, body, RefKind::Function, callee),
+            CallArgs{}
+        );
+
+        body->appendStatement(std::make_shared<ExprWrapperStatement>(ExprWrapperStatementOpts{
+            body,
+            callExpr
+        }));
+
+        return callExpr;
+    }
+
+    ionshared::Ptr<VariableRefExpr> resolvedVariableRef(const ionshared::Ptr<VariableDeclStatement> &variableDecl) {
+        return std::make_shared<VariableRefExpr>(std::make_shared<Ref<VariableDeclStatement>>(
+            variableDecl->name,
+            variableDecl->getUnboxedParent(),
+            RefKind::Variable,
+            variableDecl
+        ));
+    }
+
+    size_t countDiagnostics(
+        const ionshared::Ptr<ionshared::PassContext> &context,
+        const ionshared::Diagnostic &diagnostic
+    ) {
+        size_t count = 0;
+
+        for (const auto &reportedDiagnostic : context->diagnosticBuilder->getDiagnostics()->unwrap()) {
+            if (reportedDiagnostic.code == diagnostic.code) {
+                count++;
+            }
+        }
+
+        return count;
+    }
 }
@@ -19,4 +19,40 @@ namespace ionlang::test::bootstrap {
     ionshared::Ptr<IonIrLoweringPass> ionIrLoweringPass();
 
     ionshared::Ptr<Function> emptyFunction(std::vector<ionshared::Ptr<Statement>> statements = {});
+
+    /**
+     * Create an empty function with the given name, registered
+     * on the module.
+     */
+    ionshared::Ptr<Function> moduleFunction(const ionshared::Ptr<Module> &module, const std::string &name);
+
+    /**
+     * Create an extern with the given name, registered on the module.
+     */
+    ionshared::Ptr<Extern> moduleExtern(const ionshared::Ptr<Module> &module, const std::string &name);
+
+    /**
+     * Append a statement calling the callee to the end of the
+     * caller's body. The call is already resolved.
+     */
+    ionshared::Ptr<CallExpr> appendCall(
+        const ionshared::Ptr<Function> &caller,
+        const ionshared::Ptr<Construct> &callee,
+        const std::string &name
+    );
+
+    /**
+     * Create a reference expression to the variable, already
+     * resolved to its declaration.
+     */
+    ionshared::Ptr<VariableRefExpr> resolvedVariableRef(const ionshared::Ptr<VariableDeclStatement> &variableDecl);
+
+    /**
+     * The amount of diagnostics of the given kind reported through
+     * the context's diagnostic builder.
+     */
+    size_t countDiagnostics(
+        const ionshared::Ptr<ionshared::PassContext> &context,
+        const ionshared::Diagnostic &diagnostic
+    );
 }
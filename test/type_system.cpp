@@ -0,0 +1,65 @@
+#include <ionlang/type_system/type_context.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(TypeSystemTest, InternBuiltInTypes) {
+    TypeContext typeContext = TypeContext();
+
+    EXPECT_EQ(
+        typeContext.getIntegerType(IntegerKind::Int32),
+        typeContext.getIntegerType(IntegerKind::Int32)
+    );
+
+    EXPECT_EQ(typeContext.getBooleanType(), typeContext.getBooleanType());
+    EXPECT_EQ(typeContext.getVoidType(), typeContext.getVoidType());
+    EXPECT_EQ(typeContext.getSize(), 3);
+    EXPECT_TRUE(typeContext.getVoidType()->isInterned);
+}
+
+TEST(TypeSystemTest, DistinguishTypeProperties) {
+    TypeContext typeContext = TypeContext();
+    ionshared::Ptr<TypeQualifiers> qualifiers = std::make_shared<TypeQualifiers>();
+
+    qualifiers->add(TypeQualifier::Pointer);
+
+    ionshared::Ptr<IntegerType> int32 = typeContext.getIntegerType(IntegerKind::Int32);
+
+    EXPECT_NE(int32, typeContext.getIntegerType(IntegerKind::Int64));
+    EXPECT_NE(int32, typeContext.getIntegerType(IntegerKind::Int32, false));
+    EXPECT_NE(int32, typeContext.getIntegerType(IntegerKind::Int32, true, qualifiers));
+
+    EXPECT_EQ(
+        typeContext.getIntegerType(IntegerKind::Int32, true, qualifiers),
+        typeContext.getIntegerType(IntegerKind::Int32, true, qualifiers)
+    );
+}
+
+TEST(TypeSystemTest, TypeFactoryUsesDefaultContext) {
+    EXPECT_EQ(type_factory::typeInteger32(), type_factory::typeInteger32());
+    EXPECT_EQ(type_factory::typeChar(), type_factory::typeInteger8(false));
+    EXPECT_EQ(type_factory::typeVoid(), TypeContext::getDefault()->getVoidType());
+}
+
+TEST(TypeSystemTest, GetQualifiedVariants) {
+    TypeContext typeContext = TypeContext();
+    ionshared::Ptr<TypeQualifiers> qualifiers = std::make_shared<TypeQualifiers>();
+
+    qualifiers->add(TypeQualifier::Constant);
+
+    ionshared::Ptr<IntegerType> int32 = typeContext.getIntegerType(IntegerKind::Int32);
+    ionshared::Ptr<Type> constantInt32 = typeContext.getQualifiedType(int32, qualifiers);
+
+    // Canonical instances are left untouched.
+    EXPECT_THROW((void)int32->addQualifier(TypeQualifier::Constant), std::runtime_error);
+    EXPECT_FALSE(int32->hasQualifier(TypeQualifier::Constant));
+
+    EXPECT_TRUE(constantInt32->hasQualifier(TypeQualifier::Constant));
+    EXPECT_EQ(constantInt32, typeContext.getIntegerType(IntegerKind::Int32, true, qualifiers));
+
+    // Nor do they share the caller's set.
+    qualifiers->add(TypeQualifier::Pointer);
+
+    EXPECT_FALSE(constantInt32->hasQualifier(TypeQualifier::Pointer));
+}
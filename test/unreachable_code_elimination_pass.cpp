@@ -0,0 +1,63 @@
+#include <ionlang/passes/semantic/unreachable_code_elimination_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(UnreachableCodeEliminationPassTest, RemoveStatementsAfterReturn) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+
+    statementBuilder->createReturn();
+
+    statementBuilder->createVariableDecl(
+        type_factory::typeInteger32(),
+        test::constant::foo,
+        std::make_shared<IntegerLiteral>(type_factory::typeInteger32(), 1)
+    );
+
+    ionshared::Ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>();
+    UnreachableCodeEliminationPass pass = UnreachableCodeEliminationPass(context);
+
+    pass.visit(function);
+
+    ASSERT_EQ(function->body->statements.size(), 1);
+    EXPECT_EQ(function->body->statements[0]->statementKind, StatementKind::Return);
+    EXPECT_EQ(function->body->symbolTable->find(test::constant::foo), nullptr);
+    EXPECT_EQ(pass.getRemovedStatementCount(), 1);
+    EXPECT_EQ(test::bootstrap::countDiagnostics(context, diagnostic::semanticUnreachableCode), 1);
+}
+
+TEST(UnreachableCodeEliminationPassTest, RemoveStatementsAfterDivergingBranches) {
+    ionshared::Ptr<Function> function = test::bootstrap::emptyFunction();
+    ionshared::Ptr<StatementBuilder> statementBuilder = std::make_shared<StatementBuilder>(function->body);
+    ionshared::Ptr<Block> consequentBlock = std::make_shared<Block>(nullptr);
+    ionshared::Ptr<Block> alternativeBlock = std::make_shared<Block>(nullptr);
+    ionshared::Ptr<Block> emptyBlock = std::make_shared<Block>(nullptr);
+
+    // Left with no branches once the empty block is dropped.
+    consequentBlock->createBuilder()->createIf(
+        std::make_shared<BooleanLiteral>(true),
+        emptyBlock,
+        std::nullopt
+    );
+
+    consequentBlock->createBuilder()->createReturn();
+    alternativeBlock->createBuilder()->createReturn();
+
+    statementBuilder->createIf(std::make_shared<BooleanLiteral>(true), consequentBlock, alternativeBlock);
+    statementBuilder->createReturn();
+
+    ionshared::Ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>();
+    UnreachableCodeEliminationPass pass = UnreachableCodeEliminationPass(context);
+
+    pass.visit(function);
+
+    EXPECT_EQ(function->body->statements.size(), 1);
+    EXPECT_EQ(consequentBlock->statements.size(), 1);
+    EXPECT_EQ(pass.getRemovedStatementCount(), 2);
+
+    // Dropping the empty branch is not reported, only the trailing return is.
+    EXPECT_EQ(test::bootstrap::countDiagnostics(context, diagnostic::semanticUnreachableCode), 1);
+}